@@ -0,0 +1,317 @@
+/*
+ * Boot_Bank.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Boot_Bank.h"
+#include "Boot_Slot.h"
+
+/* Variables -----------------------------------------------------------------*/
+static Handle_Boot_Bank_S Bank_S = {0};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Bank the running image executes from. Both images are linked
+ * 			at FLASH_BASE; SYSCFG UFB says which bank is mapped there.
+ * @param : none
+ * @retval : BOOT_BANK1 / BOOT_BANK2
+ */
+uint8_t Boot_BankActive(void)
+{
+	__HAL_RCC_SYSCFG_CLK_ENABLE();
+	return (SYSCFG->CFGR1 & SYSCFG_CFGR1_UFB) ? BOOT_BANK2 : BOOT_BANK1;
+}
+
+/*
+ * @brief : Bank selected by the BFB2 option bit for the next reset.
+ * 			With BFB2 set the system memory boots bank 2, swapped to
+ * 			FLASH_BASE (UFB), if its first word is a valid stack pointer;
+ * 			otherwise it falls back to bank 1.
+ * @param : none
+ * @retval : BOOT_BANK1 / BOOT_BANK2
+ */
+uint8_t Boot_BankBootConfig(void)
+{
+	return (FLASH->OPTR & FLASH_OPTR_BFB2) ? BOOT_BANK2 : BOOT_BANK1;
+}
+
+/*
+ * @brief : Base address of the bank we are not running from. The running
+ * 			bank is always mapped at FLASH_BASE, so the other one is always
+ * 			at FLASH_BANK2_BASE, whichever bank that is.
+ * @param : none
+ * @retval : FLASH_BANK2_BASE
+ */
+uint32_t Boot_BankInactiveBase(void)
+{
+	return FLASH_BANK2_BASE;
+}
+
+/*
+ * @brief : Close the page erase that just finished: PECR back to idle and
+ * 			locked, with the result in Bank_S. Runs from RAM (.ramfunc).
+ * @param : none
+ * @retval : none
+ */
+static RAMFUNC void Boot_BankPageDone(void)
+{
+	CLEAR_BIT(FLASH->PECR, FLASH_PECR_ERASE | FLASH_PECR_PROG);
+	HAL_FLASH_Lock();
+	Bank_S.pageBusy = 0;
+
+	if (FLASH->SR & BOOT_FLASH_SR_ERRORS) {
+		Bank_S.error = FLASH->SR & BOOT_FLASH_SR_ERRORS;
+		Bank_S.state = BootBankError;
+	}
+	else if (Bank_S.eraseNext >= Bank_S.eraseEnd) {
+		Bank_S.state = BootBankErased;
+	}
+}
+
+/*
+ * @brief : Start erasing part of the inactive bank in the background.
+ * @param : offset - from the bank base, page aligned
+ * 			length - bytes to erase from offset, 0 for the rest of the bank
+ * @retval : HAL_BUSY if an erase is running, HAL_ERROR on a bad range
+ */
+HAL_StatusTypeDef Boot_BankEraseStart(uint32_t offset, uint32_t length)
+{
+	if (Bank_S.state == BootBankErasing) {
+		return HAL_BUSY;
+	}
+
+	if ((offset & (FLASH_PAGE_SIZE - 1U)) || (offset >= BOOT_BANK_SIZE) || (length > (BOOT_BANK_SIZE - offset))) {
+		return HAL_ERROR;
+	}
+	if (length == 0) {
+		length = BOOT_BANK_SIZE - offset;
+	}
+
+	Bank_S.base 		= Boot_BankInactiveBase();
+	Bank_S.eraseNext 	= Bank_S.base + offset;
+	Bank_S.eraseEnd 	= Bank_S.eraseNext + ((length + FLASH_PAGE_SIZE - 1U) & ~(FLASH_PAGE_SIZE - 1U));
+	Bank_S.error 		= 0;
+	Bank_S.pageBusy 	= 0;
+	Bank_S.state 		= BootBankErasing;
+
+	__HAL_FLASH_CLEAR_FLAG(BOOT_FLASH_SR_ERRORS);
+
+	return HAL_OK;
+}
+
+/*
+ * @brief : Advance the background erase; call from the main loop.
+ * 			Never waits on BSY: a page erase is only issued once the
+ * 			previous one has finished. PECR is unlocked for each page and
+ * 			locked again when it is done, so a data EEPROM write between
+ * 			two pages (which relocks PECR) cannot fail the next one.
+ * 			Runs from RAM (.ramfunc).
+ * @param : none
+ * @retval : state of the update
+ */
+RAMFUNC Handle_Boot_BankState_E Boot_BankService(void)
+{
+	if ((Bank_S.state != BootBankErasing) || (FLASH->SR & FLASH_SR_BSY)) {
+		return Bank_S.state;
+	}
+
+	if (Bank_S.pageBusy) {
+		Boot_BankPageDone();
+		if (Bank_S.state != BootBankErasing) {
+			return Bank_S.state;
+		}
+	}
+
+	/* Page erase: ERASE + PROG, then a write of 0 anywhere in the page */
+	if (HAL_FLASH_Unlock() != HAL_OK) {
+		Bank_S.state = BootBankError;
+		return Bank_S.state;
+	}
+	SET_BIT(FLASH->PECR, FLASH_PECR_ERASE | FLASH_PECR_PROG);
+	*(__IO uint32_t *)Bank_S.eraseNext = 0;
+	Bank_S.eraseNext += FLASH_PAGE_SIZE;
+	Bank_S.pageBusy = 1;
+
+	return Bank_S.state;
+}
+
+/*
+ * @brief : Let the page erase in flight finish (<= 3.2 ms) and leave
+ * 			PECR idle, for a data EEPROM write in the middle of a
+ * 			background erase. Boot_BankService() carries on afterwards.
+ * @param : none
+ * @retval : none
+ */
+RAMFUNC void Boot_BankPageWait(void)
+{
+	if ((Bank_S.state != BootBankErasing) || !Bank_S.pageBusy) {
+		return;
+	}
+
+	while (FLASH->SR & FLASH_SR_BSY) {
+	}
+	Boot_BankPageDone();
+}
+
+/*
+ * @brief : Erase one page of the inactive bank, waiting for it (~3 ms).
+ * 			Only the caller waits; the running bank keeps executing.
+ * @param : offset - byte offset from the bank base, page aligned
+ * @retval : HAL_BUSY while a background erase runs, HAL_ERROR if misaligned
+ */
+HAL_StatusTypeDef Boot_BankErasePage(uint32_t offset)
+{
+	HAL_StatusTypeDef status;
+	FLASH_EraseInitTypeDef erase = {0};
+	uint32_t pageError = 0;
+
+	if (Bank_S.state == BootBankErasing) {
+		return HAL_BUSY;
+	}
+
+	if ((offset & (FLASH_PAGE_SIZE - 1U)) || (offset >= BOOT_BANK_SIZE)) {
+		return HAL_ERROR;
+	}
+
+	erase.TypeErase 	= FLASH_TYPEERASE_PAGES;
+	erase.PageAddress 	= Boot_BankInactiveBase() + offset;
+	erase.NbPages 		= 1;
+
+	HAL_FLASH_Unlock();
+	status = HAL_FLASHEx_Erase(&erase, &pageError);
+	HAL_FLASH_Lock();
+
+	return status;
+}
+
+/*
+ * @brief : Program words into the inactive bank.
+ * @param : offset - byte offset from the bank base, word aligned
+ * 			data, words - source buffer
+ * @retval : HAL_BUSY while erasing, HAL_ERROR outside the bank
+ */
+RAMFUNC HAL_StatusTypeDef Boot_BankProgram(uint32_t offset, const uint32_t *data, uint32_t words)
+{
+	HAL_StatusTypeDef status = HAL_OK;
+	uint32_t address = Boot_BankInactiveBase() + offset;
+
+	if (Bank_S.state == BootBankErasing) {
+		return HAL_BUSY;
+	}
+
+	if ((offset & 3U) || ((offset + (words * 4U)) > BOOT_BANK_SIZE)) {
+		return HAL_ERROR;
+	}
+
+	HAL_FLASH_Unlock();
+	while (words-- && (status == HAL_OK)) {
+		status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, *data++);
+		address += 4U;
+	}
+	HAL_FLASH_Lock();
+
+	return status;
+}
+
+/*
+ * @brief : Program one 64 byte half-page of the inactive bank.
+ * 			HAL_FLASHEx_HalfPageProgram() runs from RAM (.RamFunc), so
+ * 			the 16 word burst and the ~3 ms wait never fetch from flash.
+ * 			A half-page that already holds the data is skipped, which lets
+ * 			a resumed update rewrite chunks it is not sure about.
+ * @param : offset - byte offset from the bank base, half-page aligned
+ * 			data - 16 words, word aligned
+ * @retval : HAL_ERROR if misaligned or the half-page is neither erased nor equal
+ */
+RAMFUNC HAL_StatusTypeDef Boot_BankProgramHalfPage(uint32_t offset, const uint32_t *data)
+{
+	HAL_StatusTypeDef status;
+	uint32_t address = Boot_BankInactiveBase() + offset;
+	const volatile uint32_t *dest = (const volatile uint32_t *)address;
+	uint8_t same = 1, erased = 1;
+
+	if (Bank_S.state == BootBankErasing) {
+		return HAL_BUSY;
+	}
+
+	if ((offset & (BOOT_HALF_PAGE_SIZE - 1U)) || (offset >= BOOT_BANK_SIZE) || ((uint32_t)data & 3U)) {
+		return HAL_ERROR;
+	}
+
+	for (uint8_t i = 0; i < (BOOT_HALF_PAGE_SIZE / 4U); i++) {
+		same 	&= (dest[i] == data[i]);
+		erased 	&= (dest[i] == 0);
+	}
+
+	if (same) {
+		return HAL_OK;
+	}
+	if (!erased) {
+		return HAL_ERROR;
+	}
+
+	HAL_FLASH_Unlock();
+	status = HAL_FLASHEx_HalfPageProgram(address, (uint32_t *)data);
+	HAL_FLASH_Lock();
+
+	return status;
+}
+
+/*
+ * @brief : Boot a bank from the next reset on: BFB2 is set for bank 2 or
+ * 			cleared for bank 1 and the option bytes are reloaded, which
+ * 			resets the MCU. Either image then runs at FLASH_BASE.
+ * @param : bank - BOOT_BANK1 / BOOT_BANK2
+ * @retval : HAL_ERROR if the option bytes could not be written; does
+ * 			not return otherwise
+ */
+HAL_StatusTypeDef Boot_BankBoot(uint8_t bank)
+{
+	FLASH_AdvOBProgramInitTypeDef ob = {0};
+
+	if (Bank_S.state == BootBankErasing) {
+		return HAL_ERROR;
+	}
+
+	if (Boot_BankBootConfig() == bank) {
+		NVIC_SystemReset();
+	}
+
+	ob.OptionType = OPTIONBYTE_BOOTCONFIG;
+	ob.BootConfig = (bank == BOOT_BANK2) ? OB_BOOT_BANK2 : OB_BOOT_BANK1;
+
+	HAL_FLASH_Unlock();
+	HAL_FLASH_OB_Unlock();
+	if (HAL_FLASHEx_AdvOBProgram(&ob) == HAL_OK) {
+		HAL_FLASH_OB_Launch();
+	}
+	HAL_FLASH_OB_Lock();
+	HAL_FLASH_Lock();
+
+	return HAL_ERROR;
+}
+
+/*
+ * @brief : Boot the inactive bank from the next reset on.
+ * 			The image there must pass Boot_SlotVerify() first. It is
+ * 			pinned, so Boot_Select() does not switch straight back to
+ * 			a newer version in the other bank.
+ * @param : none
+ * @retval : HAL_ERROR if the image is not valid; does not return otherwise
+ */
+HAL_StatusTypeDef Boot_BankSwitch(void)
+{
+	uint8_t target = (Boot_BankActive() == BOOT_BANK1) ? BOOT_BANK2 : BOOT_BANK1;
+	uint8_t slot = (target == BOOT_BANK1) ? BOOT_SLOT_APP1 : BOOT_SLOT_APP2;
+
+	if ((Bank_S.state == BootBankErasing) || (Boot_SlotVerify(slot) != BootSlotValid)) {
+		return HAL_ERROR;
+	}
+
+	Boot_SlotPin(slot);
+	return Boot_BankBoot(target);
+}
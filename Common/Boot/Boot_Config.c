@@ -0,0 +1,199 @@
+/*
+ * Boot_Config.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Data EEPROM is memory mapped, so a current-version record is used in
+ *  place: loading is one CRC check per copy and no copy into RAM.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Boot_Config.h"
+#include "Watchdog.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Define --------------------------------------------------------------------*/
+#define BOOT_CONFIG_WORDS 				(sizeof(Handle_Boot_Config_S) / 4U)
+
+/* Variables -----------------------------------------------------------------*/
+static const Handle_Boot_Config_S 	*Cfg_current = NULL;
+static uint32_t 					Cfg_address  = 0;		/* copy Cfg_current came from */
+static Handle_Boot_Config_S 		Cfg_ram;				/* defaults or a migrated copy */
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Check one EEPROM copy.
+ * @param : address - BOOT_CONFIG_ADDRESS_A / _B
+ * @retval : the record, or NULL when it is blank, torn or from a newer layout
+ */
+static const Handle_Boot_Config_S *Cfg_Check(uint32_t address)
+{
+	const Handle_Boot_Config_S *cfg = (const Handle_Boot_Config_S *)address;
+	const uint32_t *words = (const uint32_t *)address;
+	uint32_t n;
+
+	if ((cfg->magic != BOOT_CONFIG_MAGIC) || (cfg->version > BOOT_CONFIG_VERSION)
+			|| (cfg->length < 16U) || (cfg->length > BOOT_CONFIG_SLOT_SIZE) || (cfg->length & 3U)) {
+		return NULL;
+	}
+	n = (cfg->length / 4U) - 1U;
+
+	Boot_CrcBegin();
+	Boot_CrcFeed(words, n);
+	return (Boot_CrcEnd() == words[n]) ? cfg : NULL;
+}
+
+/*
+ * @brief : Find the newest valid copy. Call once at boot; afterwards
+ * 			Boot_ConfigGet() returns the same pointer.
+ * @param : none
+ * @retval : the record, never NULL; zeroed defaults when neither copy is valid
+ */
+const Handle_Boot_Config_S *Boot_ConfigLoad(void)
+{
+	const Handle_Boot_Config_S *a = Cfg_Check(BOOT_CONFIG_ADDRESS_A);
+	const Handle_Boot_Config_S *b = Cfg_Check(BOOT_CONFIG_ADDRESS_B);
+	const Handle_Boot_Config_S *pick = a;
+
+	if ((b != NULL) && ((a == NULL) || ((int32_t)(b->sequence - a->sequence) > 0))) {
+		pick = b;
+	}
+
+	memset(&Cfg_ram, 0, sizeof(Cfg_ram));
+	Cfg_ram.magic 	= BOOT_CONFIG_MAGIC;
+	Cfg_ram.version = BOOT_CONFIG_VERSION;
+	Cfg_ram.length 	= sizeof(Cfg_ram);
+	Cfg_ram.lastSlot = BOOT_SLOT_NONE;
+	Cfg_address = 0;
+
+	if (pick == NULL) {
+		Cfg_current = &Cfg_ram;
+		return Cfg_current;
+	}
+
+	Cfg_address = (uint32_t)pick;
+	if ((pick->version == BOOT_CONFIG_VERSION) && (pick->length == sizeof(Handle_Boot_Config_S))) {
+		Cfg_current = pick;
+		return Cfg_current;
+	}
+
+	/* Older layout: keep its fields, new ones stay zero until the next save */
+	memcpy(&Cfg_ram, pick, pick->length - 4U);
+	Cfg_ram.version = BOOT_CONFIG_VERSION;
+	Cfg_ram.length 	= sizeof(Cfg_ram);
+	Cfg_current = &Cfg_ram;
+	return Cfg_current;
+}
+
+/*
+ * @brief : Current record.
+ * @param : none
+ * @retval : the record Boot_ConfigLoad() or the last save settled on
+ */
+const Handle_Boot_Config_S *Boot_ConfigGet(void)
+{
+	return (Cfg_current != NULL) ? Cfg_current : Boot_ConfigLoad();
+}
+
+/*
+ * @brief : Write a new record over the older copy. Unchanged words are
+ * 			skipped (~3 ms each otherwise); the CRC word goes last.
+ * @param : cfg - new contents; header and CRC fields are filled in here
+ * @retval : HAL_OK, or HAL_ERROR when the copy does not read back
+ */
+HAL_StatusTypeDef Boot_ConfigSave(const Handle_Boot_Config_S *cfg)
+{
+	Handle_Boot_Config_S rec;
+	const uint32_t *words = (const uint32_t *)&rec;
+	uint32_t target = (Cfg_address == BOOT_CONFIG_ADDRESS_A) ? BOOT_CONFIG_ADDRESS_B : BOOT_CONFIG_ADDRESS_A;
+
+	memcpy(&rec, cfg, sizeof(rec));
+	rec.magic 	 = BOOT_CONFIG_MAGIC;
+	rec.version  = BOOT_CONFIG_VERSION;
+	rec.length 	 = sizeof(rec);
+	rec.sequence = Boot_ConfigGet()->sequence + 1U;
+
+	Boot_CrcBegin();
+	Boot_CrcFeed(words, BOOT_CONFIG_WORDS - 1U);
+	rec.crc32 = Boot_CrcEnd();
+
+	/* Invalidate first: a reset mid-write must not leave old CRC over new data */
+	Boot_EepromWrite(target + offsetof(Handle_Boot_Config_S, crc32), ~rec.crc32);
+	for (uint32_t i = 0; i < BOOT_CONFIG_WORDS; i++) {
+		Boot_EepromWrite(target + (i * 4U), words[i]);
+	}
+
+	if (Cfg_Check(target) == NULL) {
+		return HAL_ERROR;
+	}
+	Cfg_current = (const Handle_Boot_Config_S *)target;
+	Cfg_address = target;
+	return HAL_OK;
+}
+
+/*
+ * @brief : Why this image is running. Reads and clears the RCC reset flags.
+ * @param : none
+ * @retval : Handle_Boot_ResetCause_E
+ */
+Handle_Boot_ResetCause_E Boot_ConfigResetCause(void)
+{
+	uint32_t csr = RCC->CSR;
+	Handle_Boot_ResetCause_E cause = BootResetUnknown;
+
+	/* The pin flag is set by every internal reset as well, so it goes last */
+	if (csr & RCC_CSR_LPWRRSTF) {
+		cause = BootResetLowPower;
+	} else if (csr & RCC_CSR_WWDGRSTF) {
+		cause = BootResetWwdg;
+	} else if (csr & RCC_CSR_IWDGRSTF) {
+		cause = BootResetIwdg;
+	} else if (csr & RCC_CSR_FWRSTF) {
+		cause = BootResetFirewall;
+	} else if (csr & RCC_CSR_OBLRSTF) {
+		cause = BootResetOptionBytes;
+	} else if (csr & RCC_CSR_SFTRSTF) {
+		cause = BootResetSoftware;
+	} else if (csr & RCC_CSR_PORRSTF) {
+		cause = BootResetPowerOn;
+	} else if (csr & RCC_CSR_PINRSTF) {
+		cause = BootResetPin;
+	}
+
+	__HAL_RCC_CLEAR_RESET_FLAGS();
+	return cause;
+}
+
+/*
+ * @brief : Count this boot: reset cause, per-slot boots and slot health.
+ * 			Costs a few EEPROM words, so run it deferred.
+ * @param : slot - running slot, Boot_SlotRunning()
+ * @retval : Boot_ConfigSave() status
+ */
+HAL_StatusTypeDef Boot_ConfigRecordBoot(uint8_t slot)
+{
+	Handle_Boot_Config_S cfg = *Boot_ConfigGet();
+
+	cfg.resetCause = (uint8_t)Boot_ConfigResetCause();
+	cfg.lastSlot   = slot;
+	cfg.bootCount++;
+	if ((cfg.resetCause == BootResetIwdg) || (cfg.resetCause == BootResetWwdg)) {
+		cfg.watchdogCount++;
+	}
+	if (Wdg_Last.reason != WdgReasonNone) {
+		cfg.wdgReason = Wdg_Last.reason;
+		cfg.wdgTask   = Wdg_Last.task;
+	}
+	if (slot < BOOT_SLOT_COUNT) {
+		cfg.slotBoots[slot]++;
+	}
+
+	for (uint8_t i = 0; i < BOOT_SLOT_COUNT; i++) {
+		cfg.slotStatus[i] = (uint8_t)Boot_Report.status[i];
+	}
+
+	return Boot_ConfigSave(&cfg);
+}
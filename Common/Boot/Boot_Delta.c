@@ -0,0 +1,253 @@
+/*
+ * Boot_Delta.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Boot_Delta.h"
+#include <string.h>
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Append bytes of the new image, writing each full block.
+ * @param : delta, data, len
+ * @retval : BootDeltaOk or the error that stopped the stream
+ */
+static Handle_Boot_DeltaStatus_E Delta_Output(Handle_Boot_Delta_S *delta, const uint8_t *data, uint32_t len)
+{
+	uint8_t *block = (uint8_t *)delta->block;
+
+	if (len > (delta->newLength - delta->outPos)) {
+		return BootDeltaOutOfRange;
+	}
+
+	while (len) {
+		uint32_t fill = delta->outPos % BOOT_DELTA_BLOCK_SIZE;
+		uint32_t n = BOOT_DELTA_BLOCK_SIZE - fill;
+
+		if (n > len) {
+			n = len;
+		}
+		memcpy(&block[fill], data, n);
+		delta->outPos += n;
+		data += n;
+		len  -= n;
+
+		if ((fill + n) == BOOT_DELTA_BLOCK_SIZE) {
+			if (delta->write(delta->outPos - BOOT_DELTA_BLOCK_SIZE, delta->block) != 0) {
+				return BootDeltaWriteError;
+			}
+		}
+	}
+
+	return BootDeltaOk;
+}
+
+/*
+ * @brief : Start applying a patch.
+ * @param : delta - applier state
+ * 			oldBase, oldLength - image the patch was made against
+ * 			oldCrc - its slot header CRC, checked against the patch
+ * 			write - block writer for the new image
+ * @retval : none
+ */
+void Boot_DeltaBegin(Handle_Boot_Delta_S *delta, const uint8_t *oldBase, uint32_t oldLength,
+		uint32_t oldCrc, Boot_DeltaWrite_t write)
+{
+	memset(delta, 0, sizeof(*delta));
+
+	delta->oldBase 		= oldBase;
+	delta->oldLength 	= oldLength;
+	delta->oldCrc 		= oldCrc;
+	delta->write 		= write;
+	delta->stage 		= DeltaHeader;
+	delta->status 		= BootDeltaOk;
+}
+
+/*
+ * @brief : Feed the next piece of the patch stream, any size, and apply
+ * 			all of it.
+ * @param : delta, data, len
+ * @retval : BootDeltaOk, BootDeltaDone after the END op, or an error
+ * 			(errors are sticky)
+ */
+Handle_Boot_DeltaStatus_E Boot_DeltaFeed(Handle_Boot_Delta_S *delta, const uint8_t *data, uint32_t len)
+{
+	uint32_t used;
+
+	return Boot_DeltaStep(delta, data, len, 0xFFFFFFFFUL, &used);
+}
+
+/*
+ * @brief : Apply the patch stream in bounded steps. Stops once maxOut
+ * 			bytes of new image were written, so one long COPY or ADD is
+ * 			spread over several calls; call again with the rest of the
+ * 			input, or with none while Boot_DeltaCopying().
+ * @param : delta, data, len
+ * 			maxOut - most output bytes (flash writes) for this call
+ * 			used - input bytes taken
+ * @retval : BootDeltaOk, BootDeltaDone after the END op, or an error
+ * 			(errors are sticky)
+ */
+Handle_Boot_DeltaStatus_E Boot_DeltaStep(Handle_Boot_Delta_S *delta, const uint8_t *data, uint32_t len,
+		uint32_t maxOut, uint32_t *used)
+{
+	uint32_t outStart = delta->outPos;
+	uint32_t left = len;
+
+	while ((left || (delta->stage == DeltaCopy)) && (delta->status == BootDeltaOk)
+			&& ((delta->outPos - outStart) < maxOut)) {
+		uint32_t room = maxOut - (delta->outPos - outStart);
+
+		switch (delta->stage) {
+		case DeltaHeader:
+			((uint8_t *)delta->header)[delta->headerFill++] = *data++;
+			left--;
+
+			if (delta->headerFill == BOOT_DELTA_HEADER_SIZE) {
+				delta->newLength 	= delta->header[2];
+				delta->newCrc 		= delta->header[3];
+
+				if (delta->header[0] != BOOT_DELTA_MAGIC) {
+					delta->status = BootDeltaBadHeader;
+				}
+				else if (delta->header[1] != delta->oldCrc) {
+					delta->status = BootDeltaBadBase;
+				}
+				delta->stage = DeltaOp;
+			}
+			break;
+
+		case DeltaOp:
+			delta->op 		= *data++;
+			left--;
+			delta->varint 	= 0;
+			delta->shift 	= 0;
+
+			if (delta->op == BOOT_DELTA_OP_END) {
+				delta->stage = DeltaEnd;
+				delta->status = (delta->outPos == delta->newLength) ? BootDeltaDone : BootDeltaTruncated;
+			}
+			else if ((delta->op == BOOT_DELTA_OP_COPY) || (delta->op == BOOT_DELTA_OP_ADD)) {
+				delta->stage = DeltaLength;
+			}
+			else {
+				delta->status = BootDeltaBadOp;
+			}
+			break;
+
+		case DeltaLength:
+		case DeltaOffset:
+		{
+			uint8_t byte = *data++;
+			left--;
+
+			if (delta->shift > 28) {
+				delta->status = BootDeltaBadOp;
+				break;
+			}
+			delta->varint |= (uint32_t)(byte & 0x7FU) << delta->shift;
+			delta->shift  += 7;
+			if (byte & 0x80U) {
+				break;
+			}
+
+			if (delta->stage == DeltaLength) {
+				delta->length 	= delta->varint;
+				delta->varint 	= 0;
+				delta->shift 	= 0;
+				delta->stage 	= (delta->op == BOOT_DELTA_OP_ADD) ? DeltaAdd : DeltaOffset;
+				if ((delta->op == BOOT_DELTA_OP_ADD) && (delta->length == 0)) {
+					delta->stage = DeltaOp;
+				}
+				break;
+			}
+
+			/* COPY: zigzag offset, then straight from the base image */
+			delta->oldPos += (uint32_t)((int32_t)(delta->varint >> 1) ^ -(int32_t)(delta->varint & 1U));
+			if ((delta->oldPos > delta->oldLength) || (delta->length > (delta->oldLength - delta->oldPos))) {
+				delta->status = BootDeltaOutOfRange;
+				break;
+			}
+			delta->stage = DeltaCopy;
+			break;
+		}
+
+		case DeltaCopy:
+		{
+			uint32_t n = (room < delta->length) ? room : delta->length;
+
+			delta->status 	= Delta_Output(delta, &delta->oldBase[delta->oldPos], n);
+			delta->oldPos  += n;
+			delta->length  -= n;
+			if (delta->length == 0) {
+				delta->stage = DeltaOp;
+			}
+			break;
+		}
+
+		case DeltaAdd:
+		{
+			uint32_t n = (left < delta->length) ? left : delta->length;
+
+			if (n > room) {
+				n = room;
+			}
+			delta->status 	= Delta_Output(delta, data, n);
+			delta->length  -= n;
+			data 		   += n;
+			left 		   -= n;
+			if (delta->length == 0) {
+				delta->stage = DeltaOp;
+			}
+			break;
+		}
+
+		case DeltaEnd:
+		default:
+			/* Trailing bytes (transport padding) are ignored */
+			left = 0;
+			break;
+		}
+	}
+
+	*used = len - left;
+	return delta->status;
+}
+
+/*
+ * @brief : A COPY is still being written: Boot_DeltaStep() has work to
+ * 			do without more input.
+ * @param : delta
+ * @retval : 1 while a COPY is in progress
+ */
+uint8_t Boot_DeltaCopying(const Handle_Boot_Delta_S *delta)
+{
+	return (delta->stage == DeltaCopy) && (delta->status == BootDeltaOk);
+}
+
+/*
+ * @brief : Finish the patch: write the last partial block, zero padded.
+ * @param : delta
+ * @retval : BootDeltaDone if the whole new image was produced
+ */
+Handle_Boot_DeltaStatus_E Boot_DeltaEnd(Handle_Boot_Delta_S *delta)
+{
+	uint32_t fill = delta->outPos % BOOT_DELTA_BLOCK_SIZE;
+
+	if (delta->status != BootDeltaDone) {
+		return (delta->status == BootDeltaOk) ? BootDeltaTruncated : delta->status;
+	}
+
+	if (fill) {
+		memset((uint8_t *)delta->block + fill, 0, BOOT_DELTA_BLOCK_SIZE - fill);
+		if (delta->write(delta->outPos - fill, delta->block) != 0) {
+			delta->status = BootDeltaWriteError;
+		}
+	}
+
+	return delta->status;
+}
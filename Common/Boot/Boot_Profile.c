@@ -0,0 +1,141 @@
+/*
+ * Boot_Profile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Boot-time profiler and deferred start-up work.
+ *
+ *  Reset_Handler calls Boot_ProfileReset() before the data copy and
+ *  leaves SysTick free-running on the reset clock. Marks up to HAL_Init()
+ *  read that counter; once HAL owns SysTick the time is the HAL tick
+ *  plus the SysTick fraction, offset by the last free-running stamp.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Boot_Profile.h"
+#include "Console.h"
+
+/* Define --------------------------------------------------------------------*/
+#define BOOT_PROFILE_SYSTICK_MASK 		0x00FFFFFFUL
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	Boot_DeferFn_t 	fn;
+	uint32_t 		due;
+
+}Handle_Boot_Defer_S;
+
+/* Variables -----------------------------------------------------------------*/
+Handle_Boot_Profile_S Boot_Profile __attribute__((section(".noinit")));
+
+static Handle_Boot_Defer_S Boot_DeferQ[BOOT_DEFER_MAX];
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : First code after reset, called from Reset_Handler.
+ * 			Runs before .data/.bss exist: touches only SysTick and .noinit.
+ * @param : none
+ * @retval : none
+ */
+void Boot_ProfileReset(void)
+{
+	SysTick->LOAD = BOOT_PROFILE_SYSTICK_MASK;
+	SysTick->VAL  = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+	Boot_Profile.tickReset = SysTick->VAL;
+	Boot_Profile.halBaseUs = 0;
+	Boot_Profile.count     = 0;
+}
+
+/*
+ * @brief : Microseconds since reset.
+ * @param : none
+ * @retval : microseconds
+ */
+uint32_t Boot_ProfileNowUs(void)
+{
+	uint32_t ms, val;
+
+	/* HAL_InitTick() never uses the full 24-bit reload */
+	if (SysTick->LOAD == BOOT_PROFILE_SYSTICK_MASK) {
+		val = (Boot_Profile.tickReset - SysTick->VAL) & BOOT_PROFILE_SYSTICK_MASK;
+		Boot_Profile.halBaseUs = (uint32_t)(((uint64_t)val * 1000000UL) / BOOT_PROFILE_RESET_HZ);
+		return Boot_Profile.halBaseUs;
+	}
+
+	do {
+		ms 	= HAL_GetTick();
+		val = SysTick->VAL;
+	} while (ms != HAL_GetTick());
+
+	return Boot_Profile.halBaseUs + (ms * 1000UL) + (((SysTick->LOAD - val) * 1000UL) / (SysTick->LOAD + 1UL));
+}
+
+/*
+ * @brief : Record the end of a boot phase.
+ * @param : name - phase name, must stay valid (string literal)
+ * @retval : none
+ */
+void Boot_ProfileMark(const char *name)
+{
+	if (Boot_Profile.count < BOOT_PROFILE_MAX_MARKS) {
+		Boot_Profile.mark[Boot_Profile.count].name = name;
+		Boot_Profile.mark[Boot_Profile.count].us   = Boot_ProfileNowUs();
+		Boot_Profile.count++;
+	}
+}
+
+/*
+ * @brief : Print the boot timeline on the console.
+ * @param : none
+ * @retval : none
+ */
+void Boot_ProfileReport(void)
+{
+	uint32_t prev = 0;
+
+	for (uint32_t i = 0; i < Boot_Profile.count; i++) {
+		Console_Printf("Boot: %-12s %7lu us (+%lu)\n", Boot_Profile.mark[i].name,
+				Boot_Profile.mark[i].us, Boot_Profile.mark[i].us - prev);
+		prev = Boot_Profile.mark[i].us;
+	}
+}
+
+/*
+ * @brief : Run a function from the main loop instead of during start-up.
+ * @param : fn      - work to run once
+ * 			delayMs - earliest start, in HAL ticks from now
+ * @retval : HAL_OK, or HAL_ERROR when the queue is full
+ */
+HAL_StatusTypeDef Boot_Defer(Boot_DeferFn_t fn, uint32_t delayMs)
+{
+	for (uint32_t i = 0; i < BOOT_DEFER_MAX; i++) {
+		if (Boot_DeferQ[i].fn == NULL) {
+			Boot_DeferQ[i].due = HAL_GetTick() + delayMs;
+			Boot_DeferQ[i].fn  = fn;
+			return HAL_OK;
+		}
+	}
+	return HAL_ERROR;
+}
+
+/*
+ * @brief : Main loop hook: runs every deferred function that is due.
+ * @param : none
+ * @retval : none
+ */
+void Boot_DeferService(void)
+{
+	uint32_t now = HAL_GetTick();
+
+	for (uint32_t i = 0; i < BOOT_DEFER_MAX; i++) {
+		Boot_DeferFn_t fn = Boot_DeferQ[i].fn;
+
+		if ((fn != NULL) && ((int32_t)(now - Boot_DeferQ[i].due) >= 0)) {
+			Boot_DeferQ[i].fn = NULL;
+			fn();
+		}
+	}
+}
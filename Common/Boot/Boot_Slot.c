@@ -0,0 +1,327 @@
+/*
+ * Boot_Slot.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Boot_Slot.h"
+#include "Boot_Bank.h"
+#include <stddef.h>
+
+/* Define --------------------------------------------------------------------*/
+#define BOOT_CRC_SKIP_OFFSET 			(BOOT_SLOT_HEADER_OFFSET + offsetof(Handle_Boot_SlotHeader_S, crc32))
+
+#ifndef APP_VERSION
+#define APP_VERSION 					0U
+#endif
+
+/* Variables -----------------------------------------------------------------*/
+/* Image length from the linker script, see _image_length */
+extern uint32_t _image_length;
+
+const Handle_Boot_SlotHeader_S Boot_SlotHeader __attribute__((section(".slot_header"), used)) = {
+	.magic 		= BOOT_SLOT_MAGIC,
+	.version 	= APP_VERSION,
+	.length 	= (uint32_t)&_image_length,
+	.crc32 		= BOOT_SLOT_UNSIGNED,
+};
+
+Handle_Boot_Report_S Boot_Report;
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Free-running microsecond time from the HAL tick and SysTick.
+ * @param : none
+ * @retval : microseconds
+ */
+static uint32_t Boot_TimeUs(void)
+{
+	uint32_t ms, val;
+
+	do {
+		ms 	= HAL_GetTick();
+		val = SysTick->VAL;
+	} while (ms != HAL_GetTick());
+
+	return (ms * 1000UL) + (((SysTick->LOAD - val) * 1000UL) / (SysTick->LOAD + 1UL));
+}
+
+/*
+ * @brief : Slot of the running image: the bank mapped at FLASH_BASE.
+ * @param : none
+ * @retval : BOOT_SLOT_APP1 (bank 1) / BOOT_SLOT_APP2 (bank 2)
+ */
+uint8_t Boot_SlotRunning(void)
+{
+	return (Boot_BankActive() == BOOT_BANK1) ? BOOT_SLOT_APP1 : BOOT_SLOT_APP2;
+}
+
+/*
+ * @brief : Address a slot is read at. Slot n is bank n + 1; the running
+ * 			one is mapped at FLASH_BASE and the other at FLASH_BANK2_BASE.
+ * @param : slot - BOOT_SLOT_APP1 / BOOT_SLOT_APP2
+ * @retval : vector table address
+ */
+uint32_t Boot_SlotAddress(uint8_t slot)
+{
+	return (slot == Boot_SlotRunning()) ? FLASH_BASE : FLASH_BANK2_BASE;
+}
+
+/*
+ * @brief : Header of the image in a slot.
+ * @param : slot
+ * @retval : header pointer in flash
+ */
+const Handle_Boot_SlotHeader_S *Boot_SlotGetHeader(uint8_t slot)
+{
+	return (const Handle_Boot_SlotHeader_S *)(Boot_SlotAddress(slot) + BOOT_SLOT_HEADER_OFFSET);
+}
+
+/*
+ * @brief : Start a zlib CRC-32 on the CRC unit.
+ * 			Word-wise input bit reversal makes the unit consume a
+ * 			little-endian word LSB first, i.e. in byte stream order.
+ * @param : none
+ * @retval : none
+ */
+void Boot_CrcBegin(void)
+{
+	__HAL_RCC_CRC_CLK_ENABLE();
+
+	CRC->POL  = 0x04C11DB7UL;
+	CRC->INIT = 0xFFFFFFFFUL;
+	CRC->CR   = CRC_CR_REV_IN | CRC_CR_REV_OUT | CRC_CR_RESET;
+}
+
+/*
+ * @brief : Feed words to the CRC unit.
+ * @param : data - word aligned, words - number of words
+ * @retval : none
+ */
+void Boot_CrcFeed(const uint32_t *data, uint32_t words)
+{
+	while (words >= 4) {
+		CRC->DR = data[0];
+		CRC->DR = data[1];
+		CRC->DR = data[2];
+		CRC->DR = data[3];
+		data  += 4;
+		words -= 4;
+	}
+	while (words--) {
+		CRC->DR = *data++;
+	}
+}
+
+/*
+ * @brief : Finish the CRC and stop the unit clock.
+ * @param : none
+ * @retval : CRC-32
+ */
+uint32_t Boot_CrcEnd(void)
+{
+	uint32_t crc = ~CRC->DR;
+
+	__HAL_RCC_CRC_CLK_DISABLE();
+	return crc;
+}
+
+/*
+ * @brief : Check magic, length and CRC of the image in a slot.
+ * 			The vectors are checked against the link address, FLASH_BASE,
+ * 			not against where the slot is read.
+ * @param : slot
+ * @retval : BootSlotValid or the reason the image was refused
+ */
+Handle_Boot_SlotStatus_E Boot_SlotVerify(uint8_t slot)
+{
+	uint32_t base 							= Boot_SlotAddress(slot);
+	uint32_t size 							= (slot == BOOT_SLOT_APP1) ? BOOT_SLOT1_SIZE : BOOT_SLOT2_SIZE;
+	const Handle_Boot_SlotHeader_S *hdr 	= Boot_SlotGetHeader(slot);
+	uint32_t sp 							= ((const volatile uint32_t *)base)[0];
+	uint32_t pc 							= ((const volatile uint32_t *)base)[1];
+
+	if ((hdr->magic != BOOT_SLOT_MAGIC) || (sp <= BOOT_RAM_START) || (sp > BOOT_RAM_END)
+			|| ((pc & 1U) == 0) || (pc < FLASH_BASE) || (pc >= (FLASH_BASE + size))) {
+		return BootSlotEmpty;
+	}
+
+	if ((hdr->length < (BOOT_SLOT_HEADER_OFFSET + sizeof(Handle_Boot_SlotHeader_S)))
+			|| (hdr->length > size) || (hdr->length & 3U)) {
+		return BootSlotBadLength;
+	}
+
+	if (hdr->crc32 == BOOT_SLOT_UNSIGNED) {
+#if BOOT_ALLOW_UNSIGNED
+		return BootSlotValid;
+#else
+		return BootSlotBadCrc;
+#endif
+	}
+
+	Boot_CrcBegin();
+	Boot_CrcFeed((const uint32_t *)base, BOOT_CRC_SKIP_OFFSET / 4);
+	Boot_CrcFeed((const uint32_t *)(base + BOOT_CRC_SKIP_OFFSET + 4), (hdr->length - BOOT_CRC_SKIP_OFFSET - 4) / 4);
+
+	return (Boot_CrcEnd() == hdr->crc32) ? BootSlotValid : BootSlotBadCrc;
+}
+
+/*
+ * @brief : Write one word of data EEPROM, skipping unchanged words.
+ * @param : address - in data EEPROM, value
+ * @retval : none
+ */
+void Boot_EepromWrite(uint32_t address, uint32_t value)
+{
+	if (*((volatile uint32_t *)address) == value) {
+		return;
+	}
+
+	/* Not with a background bank erase half way through a page */
+	Boot_BankPageWait();
+
+	HAL_FLASHEx_DATAEEPROM_Unlock();
+	HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD, address, value);
+	HAL_FLASHEx_DATAEEPROM_Lock();
+}
+
+/*
+ * @brief : Boot state in EEPROM, formatted on first use.
+ * @param : none
+ * @retval : pointer into data EEPROM
+ */
+static volatile Handle_Boot_State_S *Boot_State(void)
+{
+	volatile Handle_Boot_State_S *state = (volatile Handle_Boot_State_S *)BOOT_STATE_ADDRESS;
+
+	if (state->magic != BOOT_STATE_MAGIC) {
+		for (uint8_t i = 0; i < BOOT_SLOT_COUNT; i++) {
+			Boot_EepromWrite((uint32_t)&state->slot[i].imageCrc, 0);
+			Boot_EepromWrite((uint32_t)&state->slot[i].bootCount, 0);
+		}
+		Boot_EepromWrite((uint32_t)&state->pinSlot, BOOT_SLOT_NONE);
+		Boot_EepromWrite((uint32_t)&state->pinCrc, 0);
+		Boot_EepromWrite((uint32_t)&state->magic, BOOT_STATE_MAGIC);
+	}
+
+	return state;
+}
+
+/*
+ * @brief : Pick the newest valid image and count the boot against it.
+ * 			An image pinned by Boot_SlotPin() is picked instead while its
+ * 			slot still holds it. An image that was started
+ * 			BOOT_MAX_ATTEMPTS times without calling Boot_ConfirmSlot() is
+ * 			skipped, pinned or not, which rolls back to the other slot. If the pick is not runningSlot its bank is
+ * 			booted through BFB2 (a reset) and counts its own boot there.
+ * @param : runningSlot - Boot_SlotRunning()
+ * @retval : slot kept running (runningSlot, unless the switch failed)
+ */
+uint8_t Boot_Select(uint8_t runningSlot)
+{
+	volatile Handle_Boot_State_S *state = Boot_State();
+	uint8_t pick = BOOT_SLOT_NONE;
+	uint8_t bank;
+
+	Boot_Report.pinned = BOOT_SLOT_NONE;
+
+	for (uint8_t i = 0; i < BOOT_SLOT_COUNT; i++) {
+		const Handle_Boot_SlotHeader_S *hdr = Boot_SlotGetHeader(i);
+		uint32_t start = Boot_TimeUs();
+
+		Boot_Report.status[i] 	= Boot_SlotVerify(i);
+		Boot_Report.verifyUs[i] = Boot_TimeUs() - start;
+		Boot_Report.version[i] 	= (Boot_Report.status[i] == BootSlotValid) ? hdr->version : 0;
+
+		if (Boot_Report.status[i] != BootSlotValid) {
+			continue;
+		}
+
+		/* A new image in the slot gets a fresh set of attempts */
+		if (state->slot[i].imageCrc != hdr->crc32) {
+			Boot_EepromWrite((uint32_t)&state->slot[i].imageCrc, hdr->crc32);
+			Boot_EepromWrite((uint32_t)&state->slot[i].bootCount, 0);
+		}
+
+		if (state->slot[i].bootCount >= BOOT_MAX_ATTEMPTS) {
+			Boot_Report.status[i] = BootSlotRolledBack;
+			continue;
+		}
+
+		if ((pick == BOOT_SLOT_NONE) || (hdr->version > Boot_Report.version[pick])
+				|| ((hdr->version == Boot_Report.version[pick]) && (i == runningSlot))) {
+			pick = i;
+		}
+
+		if ((state->pinSlot == i) && (state->pinCrc == hdr->crc32)) {
+			Boot_Report.pinned = i;
+		}
+	}
+
+	/* Chosen by hand: kept even when the other slot is newer */
+	if (Boot_Report.pinned != BOOT_SLOT_NONE) {
+		pick = Boot_Report.pinned;
+	}
+
+	/* Nothing bootable elsewhere: keep running what we have */
+	if (pick == BOOT_SLOT_NONE) {
+		Boot_Report.selected = runningSlot;
+		return runningSlot;
+	}
+
+	if (pick != runningSlot) {
+		bank = (pick == BOOT_SLOT_APP1) ? BOOT_BANK1 : BOOT_BANK2;
+
+		/* BFB2 already names it, yet the system memory started this bank:
+		 * it refused the image, so stop asking for it */
+		if (Boot_BankBootConfig() == bank) {
+			Boot_EepromWrite((uint32_t)&state->slot[pick].bootCount, BOOT_MAX_ATTEMPTS);
+			Boot_Report.status[pick] = BootSlotRolledBack;
+		}
+		else {
+			Boot_BankBoot(bank);
+		}
+
+		Boot_Report.selected = runningSlot;
+		return runningSlot;
+	}
+
+	Boot_EepromWrite((uint32_t)&state->slot[pick].bootCount, state->slot[pick].bootCount + 1U);
+	Boot_Report.selected = pick;
+
+	return Boot_Report.selected;
+}
+
+/*
+ * @brief : Mark the running image healthy; clears its boot count.
+ * @param : slot - slot of the running image
+ * @retval : none
+ */
+void Boot_ConfirmSlot(uint8_t slot)
+{
+	volatile Handle_Boot_State_S *state = Boot_State();
+
+	Boot_EepromWrite((uint32_t)&state->slot[slot].bootCount, 0);
+}
+
+/*
+ * @brief : Pin the image now in a slot, so Boot_Select() boots it even
+ * 			when the other slot holds a newer version. A new image in
+ * 			the slot ends the pin.
+ * @param : slot - slot to pin, BOOT_SLOT_NONE to go back to the newest
+ * @retval : none
+ */
+void Boot_SlotPin(uint8_t slot)
+{
+	volatile Handle_Boot_State_S *state = Boot_State();
+
+	if (slot >= BOOT_SLOT_COUNT) {
+		Boot_EepromWrite((uint32_t)&state->pinSlot, BOOT_SLOT_NONE);
+		return;
+	}
+	Boot_EepromWrite((uint32_t)&state->pinCrc, Boot_SlotGetHeader(slot)->crc32);
+	Boot_EepromWrite((uint32_t)&state->pinSlot, slot);
+}
@@ -0,0 +1,572 @@
+/*
+ * Boot_Update.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Boot_Update.h"
+#include "Boot_Bank.h"
+#include "Boot_Slot.h"
+#include "Boot_Delta.h"
+#include "Console.h"
+#include <string.h>
+
+/* Variables -----------------------------------------------------------------*/
+Handle_Boot_Update_S Boot_Update = {0};
+
+static UART_HandleTypeDef *Upd_huart = NULL;
+static DMA_HandleTypeDef hdma_upd_rx;
+
+/* Patch applier state for delta sessions */
+static Handle_Boot_Delta_S Upd_Delta;
+
+/* Two frames: the DMA fills one half while the other is programmed */
+static uint8_t updBuf[2 * BOOT_UPD_FRAME_SIZE] __attribute__((aligned(4)));
+
+/* Delta chunk being applied, off the DMA ring so the next frame can land */
+static uint8_t updPatch[BOOT_UPD_CHUNK_SIZE];
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : CRC-16/CCITT-FALSE, bitwise (a frame every ~23 ms at 115200).
+ * @param : crc - running value, 0xFFFF to start; data, len
+ * @retval : updated CRC
+ */
+uint16_t Boot_UpdCrc16(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+	while (len--) {
+		crc ^= (uint16_t)(*data++) << 8;
+		for (uint8_t i = 0; i < 8; i++) {
+			crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+		}
+	}
+	return crc;
+}
+
+/*
+ * @brief : Send a reply header.
+ * @param : type - ACK / NAK, seq - next chunk expected, status
+ * @retval : none
+ */
+static void Upd_Reply(uint8_t type, uint16_t seq, Handle_Boot_UpdStatus_E status)
+{
+	Handle_Boot_UpdHeader_S reply;
+
+	reply.sof 	= BOOT_UPD_SOF;
+	reply.type 	= type;
+	reply.seq 	= seq;
+	reply.len 	= (uint16_t)status;
+	reply.crc 	= Boot_UpdCrc16(0xFFFFU, (const uint8_t *)&reply, 6U);
+
+	if (type == BOOT_UPD_NAK) {
+		Boot_Update.nakCount++;
+	}
+
+	/* Through the console ring, so replies never interleave with log text */
+	Console_Write((const char *)&reply, sizeof(reply));
+}
+
+/*
+ * @brief : (Re)arm the circular RX DMA at the start of the buffer.
+ * @param : none
+ * @retval : none
+ */
+static void Upd_StartRx(void)
+{
+	Boot_Update.rxFrames 	= 0;
+	Boot_Update.doneFrames 	= 0;
+	Boot_Update.resync 		= 0;
+
+	HAL_UART_Receive_DMA(Upd_huart, updBuf, sizeof(updBuf));
+}
+
+/*
+ * @brief : Drop frame alignment after a bad frame or an overrun.
+ * 			Reception restarts once the line has been quiet for
+ * 			BOOT_UPD_RESYNC_MS, so the next frame lands at offset 0.
+ * @param : none
+ * @retval : none
+ */
+static void Upd_Resync(void)
+{
+	HAL_UART_AbortReceive(Upd_huart);
+	Boot_Update.resync 		= 1;
+	Boot_Update.lastRxTick 	= HAL_GetTick();
+}
+
+/*
+ * @brief : Save the resume point.
+ * @param : chunksDone - chunks programmed so far
+ * @retval : none
+ */
+static void Upd_SaveResume(uint32_t chunksDone)
+{
+	volatile Handle_Boot_UpdResume_S *resume = (volatile Handle_Boot_UpdResume_S *)BOOT_UPD_STATE_ADDRESS;
+
+	Boot_EepromWrite((uint32_t)&resume->chunksDone, chunksDone);
+}
+
+/*
+ * @brief : Delta output block: erase each page as it is reached.
+ * @param : offset - in the new image, block aligned; block - 16 words
+ * @retval : 0 on success
+ */
+static int Upd_DeltaWrite(uint32_t offset, const uint32_t *block)
+{
+	if (((offset % FLASH_PAGE_SIZE) == 0) && (Boot_BankErasePage(offset) != HAL_OK)) {
+		return -1;
+	}
+	return (Boot_BankProgramHalfPage(offset, block) == HAL_OK) ? 0 : -1;
+}
+
+/*
+ * @brief : Apply the held delta chunk by up to BOOT_UPD_DELTA_STEP bytes
+ * 			of new image, so a long COPY (up to the whole bank, ~7 s of
+ * 			flash writes) is spread over many main loop passes and never
+ * 			holds off the watchdog check-in. The chunk is ACKed once it is
+ * 			fully applied; until then a BUSY ACK every BOOT_UPD_BUSY_MS
+ * 			tells the host to keep waiting instead of resending.
+ * @param : none
+ * @retval : none
+ */
+static void Upd_DeltaStep(void)
+{
+	Handle_Boot_DeltaStatus_E st;
+	uint32_t used;
+
+	st = Boot_DeltaStep(&Upd_Delta, &updPatch[Boot_Update.patchPos], Boot_Update.patchLen - Boot_Update.patchPos,
+			BOOT_UPD_DELTA_STEP, &used);
+	Boot_Update.patchPos += (uint16_t)used;
+
+	if ((st != BootDeltaOk) && (st != BootDeltaDone)) {
+		Boot_Update.patchLen = 0;
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, (st == BootDeltaWriteError) ? BootUpdFlashError : BootUpdBadImage);
+		return;
+	}
+
+	if ((st == BootDeltaOk) && ((Boot_Update.patchPos < Boot_Update.patchLen) || Boot_DeltaCopying(&Upd_Delta))) {
+		if ((HAL_GetTick() - Boot_Update.busyTick) >= BOOT_UPD_BUSY_MS) {
+			Boot_Update.busyTick = HAL_GetTick();
+			Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdBusy);
+		}
+		return;
+	}
+
+	Boot_Update.patchLen 	= 0;
+	Boot_Update.lastRxTick 	= HAL_GetTick();
+	Boot_Update.expected++;
+	Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+}
+
+/*
+ * @brief : BEGIN for a patch: rebuild the inactive bank from the running one.
+ * 			No resume; an interrupted patch starts again from chunk 0.
+ * @param : length - patch bytes, imageCrc - new image CRC
+ * @retval : none
+ */
+static void Upd_BeginDelta(uint32_t length, uint32_t imageCrc)
+{
+	uint8_t slot = (Boot_BankActive() == BOOT_BANK1) ? BOOT_SLOT_APP1 : BOOT_SLOT_APP2;
+	const Handle_Boot_SlotHeader_S *hdr = Boot_SlotGetHeader(slot);
+
+	if ((Boot_Update.state == BootUpdReceiving) && Boot_Update.delta
+			&& (Boot_Update.imageCrc == imageCrc) && (Boot_Update.length == length)) {
+		Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+		return;
+	}
+
+	if (hdr->magic != BOOT_SLOT_MAGIC) {
+		Upd_Reply(BOOT_UPD_NAK, 0, BootUpdBadImage);
+		return;
+	}
+
+	Boot_DeltaBegin(&Upd_Delta, (const uint8_t *)Boot_SlotAddress(slot), hdr->length, hdr->crc32, Upd_DeltaWrite);
+
+	Boot_Update.delta 		= 1;
+	Boot_Update.length 		= length;
+	Boot_Update.imageCrc 	= imageCrc;
+	Boot_Update.chunks 		= (uint16_t)((length + BOOT_UPD_CHUNK_SIZE - 1U) / BOOT_UPD_CHUNK_SIZE);
+	Boot_Update.expected 	= 0;
+	Boot_Update.patchLen 	= 0;
+	Boot_Update.startTick 	= HAL_GetTick();
+	Boot_Update.state 		= BootUpdReceiving;
+
+	Upd_Reply(BOOT_UPD_ACK, 0, BootUpdOk);
+}
+
+/*
+ * @brief : BEGIN - resume a matching session or erase for a new one.
+ * @param : payload - length, image crc32
+ * @retval : none
+ */
+static void Upd_Begin(const uint8_t *payload)
+{
+	volatile Handle_Boot_UpdResume_S *resume = (volatile Handle_Boot_UpdResume_S *)BOOT_UPD_STATE_ADDRESS;
+	uint32_t bank = (Boot_BankActive() == BOOT_BANK1) ? BOOT_BANK2 : BOOT_BANK1;
+	uint32_t length, imageCrc, flags, from;
+
+	memcpy(&length, &payload[0], 4);
+	memcpy(&imageCrc, &payload[4], 4);
+	memcpy(&flags, &payload[8], 4);
+
+	if (Boot_Update.state == BootUpdErasing) {
+		return;
+	}
+
+	if ((length == 0) || (length > BOOT_BANK_SIZE)) {
+		Upd_Reply(BOOT_UPD_NAK, 0, BootUpdBadLength);
+		return;
+	}
+
+	if (flags & BOOT_UPD_FLAG_DELTA) {
+		Upd_BeginDelta(length, imageCrc);
+		return;
+	}
+
+	/* Host restarted mid-session */
+	if ((Boot_Update.state == BootUpdReceiving) && !Boot_Update.delta && (Boot_Update.imageCrc == imageCrc) && (Boot_Update.length == length)) {
+		Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+		return;
+	}
+
+	Boot_Update.delta 		= 0;
+	Boot_Update.length 		= length;
+	Boot_Update.imageCrc 	= imageCrc;
+	Boot_Update.chunks 		= (uint16_t)((length + BOOT_UPD_CHUNK_SIZE - 1U) / BOOT_UPD_CHUNK_SIZE);
+	Boot_Update.startTick 	= HAL_GetTick();
+
+	/* Same image into the same bank as an interrupted session: erase what
+	 * may have been written after the last save, then carry on from there */
+	if ((resume->magic == BOOT_UPD_STATE_MAGIC) && (resume->imageCrc == imageCrc)
+			&& (resume->length == length) && (resume->bank == bank)
+			&& (resume->chunksDone <= Boot_Update.chunks)) {
+		Boot_Update.expected = (uint16_t)resume->chunksDone;
+		from = resume->chunksDone * BOOT_UPD_CHUNK_SIZE;
+
+		if (from >= length) {
+			Boot_Update.state = BootUpdReceiving;
+			Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+			return;
+		}
+		length -= from;
+		if (length > (BOOT_UPD_SAVE_CHUNKS * BOOT_UPD_CHUNK_SIZE)) {
+			length = BOOT_UPD_SAVE_CHUNKS * BOOT_UPD_CHUNK_SIZE;
+		}
+	}
+	else {
+		/* New session; the record only becomes valid once the erase is done */
+		Boot_EepromWrite((uint32_t)&resume->magic, 0);
+		Boot_EepromWrite((uint32_t)&resume->imageCrc, imageCrc);
+		Boot_EepromWrite((uint32_t)&resume->length, length);
+		Boot_EepromWrite((uint32_t)&resume->chunksDone, 0);
+		Boot_EepromWrite((uint32_t)&resume->bank, bank);
+		Boot_Update.expected = 0;
+		from = 0;
+	}
+
+	if (Boot_BankEraseStart(from, length) != HAL_OK) {
+		Upd_Reply(BOOT_UPD_NAK, 0, BootUpdFlashError);
+		return;
+	}
+	Boot_Update.state = BootUpdErasing;
+}
+
+/*
+ * @brief : DATA - program the next chunk, four half-pages, or take a
+ * 			copy of a delta chunk and start applying it.
+ * @param : seq - chunk index, payload - 256 bytes, word aligned
+ * @retval : none
+ */
+static void Upd_Data(uint16_t seq, const uint8_t *payload)
+{
+	uint32_t offset = (uint32_t)seq * BOOT_UPD_CHUNK_SIZE;
+
+	if (Boot_Update.state != BootUpdReceiving) {
+		Upd_Reply(BOOT_UPD_NAK, 0, BootUpdBadState);
+		return;
+	}
+
+	/* Retransmission of a chunk we already have */
+	if (seq < Boot_Update.expected) {
+		Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+		return;
+	}
+
+	if ((seq > Boot_Update.expected) || (seq >= Boot_Update.chunks)) {
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdGap);
+		return;
+	}
+
+	if (Boot_Update.delta) {
+		uint32_t n = Boot_Update.length - offset;
+
+		n = (n < BOOT_UPD_CHUNK_SIZE) ? n : BOOT_UPD_CHUNK_SIZE;
+		memcpy(updPatch, payload, n);
+		Boot_Update.patchLen 	= (uint16_t)n;
+		Boot_Update.patchPos 	= 0;
+		Boot_Update.busyTick 	= HAL_GetTick();
+		Upd_DeltaStep();
+		return;
+	}
+
+	for (uint32_t i = 0; i < BOOT_UPD_CHUNK_SIZE; i += BOOT_HALF_PAGE_SIZE) {
+		if (Boot_BankProgramHalfPage(offset + i, (const uint32_t *)&payload[i]) != HAL_OK) {
+			Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdFlashError);
+			return;
+		}
+	}
+
+	Boot_Update.expected++;
+	if ((Boot_Update.expected % BOOT_UPD_SAVE_CHUNKS) == 0) {
+		Upd_SaveResume(Boot_Update.expected);
+	}
+
+	Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+}
+
+/*
+ * @brief : END - check the new image against its slot header.
+ * @param : none
+ * @retval : none
+ */
+static void Upd_End(void)
+{
+	volatile Handle_Boot_UpdResume_S *resume = (volatile Handle_Boot_UpdResume_S *)BOOT_UPD_STATE_ADDRESS;
+	uint8_t slot = (Boot_BankActive() == BOOT_BANK1) ? BOOT_SLOT_APP2 : BOOT_SLOT_APP1;
+	uint32_t elapsed;
+
+	if ((Boot_Update.state != BootUpdReceiving) || (Boot_Update.expected != Boot_Update.chunks)) {
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdBadState);
+		return;
+	}
+
+	if (Boot_Update.delta && (Boot_DeltaEnd(&Upd_Delta) != BootDeltaDone)) {
+		Boot_Update.state = BootUpdIdle;
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdBadImage);
+		return;
+	}
+
+	if (Boot_SlotVerify(slot) != BootSlotValid) {
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdBadImage);
+		return;
+	}
+
+	elapsed = HAL_GetTick() - Boot_Update.startTick;
+	Boot_Update.bytesPerSec = (elapsed != 0) ? ((Boot_Update.length * 1000UL) / elapsed) : 0;
+	Boot_Update.state 		= BootUpdIdle;
+	Boot_EepromWrite((uint32_t)&resume->magic, 0);
+
+	/* A new image is the one to boot next, not an earlier manual pick */
+	Boot_SlotPin(BOOT_SLOT_NONE);
+
+	Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+}
+
+/*
+ * @brief : Check and dispatch one received frame.
+ * @param : frame - BOOT_UPD_FRAME_SIZE bytes
+ * @retval : none
+ */
+static void Upd_Process(const uint8_t *frame)
+{
+	const Handle_Boot_UpdHeader_S *hdr = (const Handle_Boot_UpdHeader_S *)frame;
+	const uint8_t *payload = &frame[BOOT_UPD_HEADER_SIZE];
+	uint16_t crc;
+
+	crc = Boot_UpdCrc16(0xFFFFU, frame, 6U);
+	crc = Boot_UpdCrc16(crc, payload, BOOT_UPD_CHUNK_SIZE);
+
+	if ((hdr->sof != BOOT_UPD_SOF) || (hdr->crc != crc)) {
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdBadFrame);
+		Upd_Resync();
+		return;
+	}
+
+	switch (hdr->type) {
+	case BOOT_UPD_BEGIN:
+		Upd_Begin(payload);
+		break;
+
+	case BOOT_UPD_DATA:
+		Upd_Data(hdr->seq, payload);
+		break;
+
+	case BOOT_UPD_END:
+		Upd_End();
+		break;
+
+	case BOOT_UPD_SWITCH:
+		if (Boot_Update.state == BootUpdIdle) {
+			/* Resets on success */
+			Boot_BankSwitch();
+		}
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdBadImage);
+		break;
+
+	default:
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdBadFrame);
+		break;
+	}
+}
+
+/*
+ * @brief : Attach the updater to a UART and start listening.
+ * 			The UART itself must already be initialised.
+ * @param : huart - UART handle (huart2)
+ * @retval : none
+ */
+void Boot_UpdateInit(UART_HandleTypeDef *huart)
+{
+	Upd_huart = huart;
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	hdma_upd_rx.Instance 					= BOOT_UPD_DMA_CHANNEL;
+	hdma_upd_rx.Init.Request 				= BOOT_UPD_DMA_REQUEST;
+	hdma_upd_rx.Init.Direction 				= DMA_PERIPH_TO_MEMORY;
+	hdma_upd_rx.Init.PeriphInc 				= DMA_PINC_DISABLE;
+	hdma_upd_rx.Init.MemInc 				= DMA_MINC_ENABLE;
+	hdma_upd_rx.Init.PeriphDataAlignment 	= DMA_PDATAALIGN_BYTE;
+	hdma_upd_rx.Init.MemDataAlignment 		= DMA_MDATAALIGN_BYTE;
+	hdma_upd_rx.Init.Mode 					= DMA_CIRCULAR;
+	hdma_upd_rx.Init.Priority 				= DMA_PRIORITY_HIGH;
+	if (HAL_DMA_Init(&hdma_upd_rx) != HAL_OK) {
+		Error_Handler();
+	}
+	__HAL_LINKDMA(huart, hdmarx, hdma_upd_rx);
+
+	HAL_NVIC_SetPriority(BOOT_UPD_DMA_IRQn, 1, 0);
+	HAL_NVIC_EnableIRQ(BOOT_UPD_DMA_IRQn);
+
+	Boot_Update.state = BootUpdIdle;
+	Upd_StartRx();
+}
+
+/*
+ * @brief : Run the updater; call from the main loop at least once per
+ * 			frame time (~23 ms). Programming a chunk takes ~13 ms, so the
+ * 			next frame is received by DMA while this one is written. A
+ * 			delta chunk is applied a step per call; the frame behind it
+ * 			waits in the DMA buffer until the chunk is ACKed.
+ * @param : none
+ * @retval : none
+ */
+void Boot_UpdateService(void)
+{
+	uint32_t pending;
+
+	if (Upd_huart == NULL) {
+		return;
+	}
+
+	if (Boot_Update.state == BootUpdErasing) {
+		Handle_Boot_BankState_E bank = Boot_BankService();
+
+		if (bank == BootBankErased) {
+			volatile Handle_Boot_UpdResume_S *resume = (volatile Handle_Boot_UpdResume_S *)BOOT_UPD_STATE_ADDRESS;
+
+			Boot_EepromWrite((uint32_t)&resume->magic, BOOT_UPD_STATE_MAGIC);
+			Boot_Update.startTick 	= HAL_GetTick();
+			Boot_Update.state 		= BootUpdReceiving;
+			Upd_Reply(BOOT_UPD_ACK, Boot_Update.expected, BootUpdOk);
+		}
+		else if (bank == BootBankError) {
+			Boot_Update.state = BootUpdIdle;
+			Upd_Reply(BOOT_UPD_NAK, 0, BootUpdFlashError);
+		}
+	}
+
+	if (Boot_Update.patchLen) {
+		Upd_DeltaStep();
+		if (Boot_Update.patchLen) {
+			return;
+		}
+	}
+
+	if (Boot_Update.resync) {
+		while (__HAL_UART_GET_FLAG(Upd_huart, UART_FLAG_RXNE)) {
+			(void)Upd_huart->Instance->RDR;
+			Boot_Update.lastRxTick = HAL_GetTick();
+		}
+		__HAL_UART_CLEAR_FLAG(Upd_huart, UART_CLEAR_OREF | UART_CLEAR_FEF | UART_CLEAR_NEF);
+
+		if ((HAL_GetTick() - Boot_Update.lastRxTick) >= BOOT_UPD_RESYNC_MS) {
+			Upd_StartRx();
+		}
+		return;
+	}
+
+	pending = Boot_Update.rxFrames - Boot_Update.doneFrames;
+
+	if (pending == 0) {
+		if ((Boot_Update.state == BootUpdReceiving) && ((HAL_GetTick() - Boot_Update.lastRxTick) > BOOT_UPD_TIMEOUT_MS)) {
+			if (!Boot_Update.delta) {
+				Upd_SaveResume(Boot_Update.expected);
+			}
+			Boot_Update.state = BootUpdIdle;
+		}
+		return;
+	}
+
+	/* The DMA is already writing over the frame we have not read */
+	if (pending >= 2) {
+		Upd_Reply(BOOT_UPD_NAK, Boot_Update.expected, BootUpdOverrun);
+		Upd_Resync();
+		return;
+	}
+
+	Upd_Process(&updBuf[(Boot_Update.doneFrames & 1U) * BOOT_UPD_FRAME_SIZE]);
+	Boot_Update.doneFrames++;
+}
+
+/*
+ * @brief : Updater session in progress.
+ * @param : none
+ * @retval : 1 while erasing, receiving or resynchronising
+ */
+uint8_t Boot_UpdateActive(void)
+{
+	return (Boot_Update.state != BootUpdIdle) || Boot_Update.resync;
+}
+
+/*
+ * @brief : RX DMA interrupt, called from DMA1_Channel4_5_6_7_IRQHandler().
+ * 			The vector is shared with the console TX DMA and enabled by
+ * 			Console_Init() first; until HAL_DMA_Init() in
+ * 			Boot_UpdateInit() has set up the handle there is no RX
+ * 			channel to serve, and the handle's registers are NULL.
+ * @param : none
+ * @retval : none
+ */
+void Boot_UpdateDmaIRQHandler(void)
+{
+	if (hdma_upd_rx.DmaBaseAddress == NULL) {
+		return;
+	}
+	HAL_DMA_IRQHandler(&hdma_upd_rx);
+}
+
+/*
+ * @brief : First frame of the buffer complete.
+ */
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (huart == Upd_huart) {
+		Boot_Update.rxFrames++;
+		Boot_Update.lastRxTick = HAL_GetTick();
+	}
+}
+
+/*
+ * @brief : Second frame of the buffer complete.
+ */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (huart == Upd_huart) {
+		Boot_Update.rxFrames++;
+		Boot_Update.lastRxTick = HAL_GetTick();
+	}
+}
@@ -0,0 +1,79 @@
+/*
+ * Boot_Bank.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_BOOT_BANK_H_
+#define INC_BOOT_BANK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define BOOT_BANK1 						1U
+#define BOOT_BANK2 						2U
+#define BOOT_BANK_SIZE 					(FLASH_BANK2_BASE - FLASH_BASE)
+#define BOOT_HALF_PAGE_SIZE 			(FLASH_PAGE_SIZE / 2U)
+
+#define BOOT_FLASH_SR_ERRORS 			(FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_SIZERR | \
+										 FLASH_SR_OPTVERR | FLASH_SR_RDERR | FLASH_SR_NOTZEROERR | \
+										 FLASH_SR_FWWERR)
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef enum {
+	BootBankIdle = 0,
+	BootBankErasing,
+	BootBankErased,
+	BootBankError,
+
+}Handle_Boot_BankState_E;
+
+/*
+ * @brief Update of the bank we are not running from.
+ * 	Both images are linked at FLASH_BASE. The bank that boots (BFB2) is
+ * 	mapped there and the other one at FLASH_BANK2_BASE, so the inactive
+ * 	bank is always written through the upper address.
+ * 	The erase runs one 128 byte page per Boot_BankService() call without
+ * 	waiting on BSY, so the running bank keeps executing (read-while-write).
+ */
+typedef struct {
+	Handle_Boot_BankState_E 	state;
+	uint32_t 					base;			/* inactive bank base			*/
+	uint32_t 					eraseNext;		/* next page to erase			*/
+	uint32_t 					eraseEnd;		/* end of the area to erase		*/
+	uint32_t 					error;			/* FLASH->SR error bits			*/
+	uint8_t 					pageBusy;		/* page erase issued, not closed	*/
+
+}Handle_Boot_Bank_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+uint8_t Boot_BankActive(void);
+uint8_t Boot_BankBootConfig(void);
+uint32_t Boot_BankInactiveBase(void);
+HAL_StatusTypeDef Boot_BankEraseStart(uint32_t offset, uint32_t length);
+Handle_Boot_BankState_E Boot_BankService(void);
+void Boot_BankPageWait(void);
+HAL_StatusTypeDef Boot_BankErasePage(uint32_t offset);
+HAL_StatusTypeDef Boot_BankProgram(uint32_t offset, const uint32_t *data, uint32_t words);
+HAL_StatusTypeDef Boot_BankProgramHalfPage(uint32_t offset, const uint32_t *data);
+HAL_StatusTypeDef Boot_BankBoot(uint8_t bank);
+HAL_StatusTypeDef Boot_BankSwitch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_BOOT_BANK_H_ */
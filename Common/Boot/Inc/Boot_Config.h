@@ -0,0 +1,92 @@
+/*
+ * Boot_Config.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_BOOT_CONFIG_H_
+#define INC_BOOT_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+#include "Boot_Slot.h"
+
+/* Define ------------------------------------------------------------*/
+/* Two copies after the boot state (+0x00) and update resume (+0x40) blocks */
+#define BOOT_CONFIG_ADDRESS_A 			(DATA_EEPROM_BASE + 0x100UL)
+#define BOOT_CONFIG_ADDRESS_B 			(DATA_EEPROM_BASE + 0x180UL)
+#define BOOT_CONFIG_SLOT_SIZE 			0x80UL
+
+#define BOOT_CONFIG_MAGIC 				0x31474643UL		/* "CFG1" */
+#define BOOT_CONFIG_VERSION 			1U
+#define BOOT_CONFIG_CAL_WORDS 			8U
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef enum {
+	BootResetUnknown = 0,
+	BootResetPowerOn,
+	BootResetPin,
+	BootResetSoftware,
+	BootResetIwdg,
+	BootResetWwdg,
+	BootResetLowPower,
+	BootResetOptionBytes,
+	BootResetFirewall,
+
+}Handle_Boot_ResetCause_E;
+
+/*
+ * @brief Config/status record shared by both images, two copies in data
+ * 	EEPROM. A save goes to the older copy and writes the CRC last, so a
+ * 	torn write leaves the other copy as the valid one. New fields go at
+ * 	the end, before crc32; a shorter record from an older version is
+ * 	read with the new fields zeroed.
+ */
+typedef struct {
+	uint32_t 	magic;
+	uint16_t 	version;
+	uint16_t 	length;				/* bytes, crc32 included			*/
+	uint32_t 	sequence;			/* newest valid copy wins			*/
+
+	uint32_t 	bootCount;
+	uint32_t 	watchdogCount;		/* IWDG and WWDG resets				*/
+	uint8_t 	resetCause;			/* Handle_Boot_ResetCause_E			*/
+	uint8_t 	lastSlot;			/* image that recorded the boot		*/
+	uint8_t 	calValid;
+	uint8_t 	reserved;
+
+	uint32_t 	slotBoots[BOOT_SLOT_COUNT];
+	uint8_t 	slotStatus[BOOT_SLOT_COUNT];	/* Handle_Boot_SlotStatus_E	*/
+	uint8_t 	wdgReason;			/* last supervised reset, Handle_Wdg_Reason_E	*/
+	uint8_t 	wdgTask;			/* its late task, WDG_TASK_NONE		*/
+
+	int32_t 	calibration[BOOT_CONFIG_CAL_WORDS];
+
+	uint32_t 	crc32;				/* zlib CRC-32 of the words before	*/
+
+}Handle_Boot_Config_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+const Handle_Boot_Config_S *Boot_ConfigLoad(void);
+const Handle_Boot_Config_S *Boot_ConfigGet(void);
+HAL_StatusTypeDef Boot_ConfigSave(const Handle_Boot_Config_S *cfg);
+Handle_Boot_ResetCause_E Boot_ConfigResetCause(void);
+HAL_StatusTypeDef Boot_ConfigRecordBoot(uint8_t slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_BOOT_CONFIG_H_ */
@@ -0,0 +1,111 @@
+/*
+ * Boot_Delta.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_BOOT_DELTA_H_
+#define INC_BOOT_DELTA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+
+/* Define ------------------------------------------------------------*/
+/*
+ * Patch stream, all fields little-endian, generated by Tools/delta_diff.py:
+ * 	header	magic "DLT1", oldCrc, newLength, newCrc		(4 x u32)
+ * 	ops		0x01 COPY	varint length, zigzag varint old offset delta
+ * 			0x02 ADD	varint length, length literal bytes
+ * 			0x00 END
+ * The old offset delta is relative to the end of the previous COPY.
+ * oldCrc / newCrc are the slot header CRCs of the base and new image.
+ */
+#define BOOT_DELTA_MAGIC 				0x31544C44UL		/* "DLT1" */
+#define BOOT_DELTA_HEADER_SIZE 			16U
+
+#define BOOT_DELTA_OP_END 				0x00U
+#define BOOT_DELTA_OP_COPY 				0x01U
+#define BOOT_DELTA_OP_ADD 				0x02U
+
+/* Output is handed to the writer in half-page blocks */
+#define BOOT_DELTA_BLOCK_SIZE 			64U
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef enum {
+	BootDeltaOk = 0,
+	BootDeltaDone,
+	BootDeltaBadHeader,
+	BootDeltaBadBase,
+	BootDeltaBadOp,
+	BootDeltaOutOfRange,
+	BootDeltaWriteError,
+	BootDeltaTruncated,
+
+}Handle_Boot_DeltaStatus_E;
+
+/*
+ * @brief Writes one block of the new image.
+ * 	offset is a multiple of BOOT_DELTA_BLOCK_SIZE; returns 0 on success.
+ */
+typedef int (*Boot_DeltaWrite_t)(uint32_t offset, const uint32_t *block);
+
+typedef enum {
+	DeltaHeader = 0,
+	DeltaOp,
+	DeltaLength,
+	DeltaOffset,
+	DeltaCopy,
+	DeltaAdd,
+	DeltaEnd,
+
+}Handle_Boot_DeltaStage_E;
+
+/* Streaming applier; a few hundred bytes of RAM whatever the image size */
+typedef struct {
+	const uint8_t 				*oldBase;			/* base image, read in place	*/
+	uint32_t 					oldLength;
+	uint32_t 					oldCrc;				/* expected base image CRC		*/
+	Boot_DeltaWrite_t 			write;
+
+	Handle_Boot_DeltaStage_E 	stage;
+	Handle_Boot_DeltaStatus_E 	status;
+	uint8_t 					op;
+	uint8_t 					shift;				/* varint decode				*/
+	uint32_t 					varint;
+	uint32_t 					length;				/* current op bytes left		*/
+	uint32_t 					oldPos;				/* end of the previous COPY		*/
+
+	uint32_t 					header[BOOT_DELTA_HEADER_SIZE / 4];
+	uint32_t 					headerFill;
+	uint32_t 					newLength;
+	uint32_t 					newCrc;
+	uint32_t 					outPos;				/* bytes of new image produced	*/
+	uint32_t 					block[BOOT_DELTA_BLOCK_SIZE / 4];
+
+}Handle_Boot_Delta_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void Boot_DeltaBegin(Handle_Boot_Delta_S *delta, const uint8_t *oldBase, uint32_t oldLength,
+		uint32_t oldCrc, Boot_DeltaWrite_t write);
+Handle_Boot_DeltaStatus_E Boot_DeltaFeed(Handle_Boot_Delta_S *delta, const uint8_t *data, uint32_t len);
+Handle_Boot_DeltaStatus_E Boot_DeltaStep(Handle_Boot_Delta_S *delta, const uint8_t *data, uint32_t len,
+		uint32_t maxOut, uint32_t *used);
+uint8_t Boot_DeltaCopying(const Handle_Boot_Delta_S *delta);
+Handle_Boot_DeltaStatus_E Boot_DeltaEnd(Handle_Boot_Delta_S *delta);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_BOOT_DELTA_H_ */
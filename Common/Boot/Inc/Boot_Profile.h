@@ -0,0 +1,67 @@
+/*
+ * Boot_Profile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_BOOT_PROFILE_H_
+#define INC_BOOT_PROFILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define BOOT_PROFILE_MAX_MARKS 			12U
+#define BOOT_PROFILE_RESET_HZ 			2097000UL	/* MSI range 5 out of reset	*/
+#define BOOT_DEFER_MAX 					8U
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef void (*Boot_DeferFn_t)(void);
+
+/*
+ * @brief One boot phase: name and time since reset
+ */
+typedef struct {
+	const char 	*name;
+	uint32_t 	us;
+
+}Handle_Boot_Mark_S;
+
+/*
+ * @brief Boot timeline. Kept in .noinit because the first stamp is taken
+ * 	by the reset handler before .data and .bss are set up.
+ */
+typedef struct {
+	uint32_t 			tickReset;		/* SysTick VAL in Reset_Handler		*/
+	uint32_t 			halBaseUs;		/* last stamp before HAL took SysTick	*/
+	uint32_t 			count;
+	Handle_Boot_Mark_S 	mark[BOOT_PROFILE_MAX_MARKS];
+
+}Handle_Boot_Profile_S;
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_Boot_Profile_S Boot_Profile;
+
+/* Function prototypes -----------------------------------------------*/
+void Boot_ProfileReset(void);
+uint32_t Boot_ProfileNowUs(void);
+void Boot_ProfileMark(const char *name);
+void Boot_ProfileReport(void);
+HAL_StatusTypeDef Boot_Defer(Boot_DeferFn_t fn, uint32_t delayMs);
+void Boot_DeferService(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_BOOT_PROFILE_H_ */
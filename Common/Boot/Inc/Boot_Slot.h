@@ -0,0 +1,125 @@
+/*
+ * Boot_Slot.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_BOOT_SLOT_H_
+#define INC_BOOT_SLOT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define BOOT_SLOT_COUNT 				2U
+#define BOOT_SLOT_APP1 					0U		/* flash bank 1 */
+#define BOOT_SLOT_APP2 					1U		/* flash bank 2 */
+#define BOOT_SLOT_NONE 					0xFFU
+
+#define BOOT_SLOT1_SIZE 				0x00018000UL		/* one 96 KB bank each */
+#define BOOT_SLOT2_SIZE 				0x00018000UL
+
+/* Initial stack pointer of a valid image lies inside SRAM */
+#define BOOT_RAM_START 					0x20000000UL
+#define BOOT_RAM_END 					0x20005000UL
+
+/* Slot header sits right after the 48-entry vector table */
+#define BOOT_SLOT_HEADER_OFFSET 		0xC0UL
+#define BOOT_SLOT_MAGIC 				0x544F4C53UL		/* "SLOT" */
+#define BOOT_SLOT_UNSIGNED 				0xFFFFFFFFUL		/* crc32 before Tools/slot_sign.py */
+
+/* Accept images whose crc32 was never patched (debugger downloads) */
+#define BOOT_ALLOW_UNSIGNED 			0
+
+/* Unconfirmed boots of one image before the selector gives up on it */
+#define BOOT_MAX_ATTEMPTS 				3U
+
+/* Boot state lives at the start of data EEPROM */
+#define BOOT_STATE_ADDRESS 				DATA_EEPROM_BASE
+#define BOOT_STATE_MAGIC 				0xB0075747UL
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief Image header, linked into .slot_header. length is filled in by
+ * 	the linker, crc32 by Tools/slot_sign.py after objcopy. The CRC is
+ * 	zlib CRC-32 over [base, base + length) with the crc32 word skipped.
+ */
+typedef struct {
+	uint32_t 	magic;
+	uint32_t 	version;
+	uint32_t 	length;
+	uint32_t 	crc32;
+
+}Handle_Boot_SlotHeader_S;
+
+/* Per-slot boot bookkeeping, kept in data EEPROM */
+typedef struct {
+	uint32_t 	imageCrc;			/* image the count belongs to		*/
+	uint32_t 	bootCount;			/* boots since the last confirm		*/
+
+}Handle_Boot_SlotState_S;
+
+/*
+ * @brief Boot state in data EEPROM. pinSlot/pinCrc hold the image picked
+ * 	by hand (Boot_BankSwitch()); Boot_Select() keeps booting it over a
+ * 	newer one while that slot still holds that image.
+ */
+typedef struct {
+	uint32_t 					magic;
+	Handle_Boot_SlotState_S 	slot[BOOT_SLOT_COUNT];
+	uint32_t 					pinSlot;			/* BOOT_SLOT_NONE: no pin			*/
+	uint32_t 					pinCrc;
+
+}Handle_Boot_State_S;
+
+typedef enum {
+	BootSlotValid = 0,
+	BootSlotEmpty,
+	BootSlotBadLength,
+	BootSlotBadCrc,
+	BootSlotRolledBack,
+
+}Handle_Boot_SlotStatus_E;
+
+/* Result of the last Boot_Select() */
+typedef struct {
+	Handle_Boot_SlotStatus_E 	status[BOOT_SLOT_COUNT];
+	uint32_t 					version[BOOT_SLOT_COUNT];
+	uint32_t 					verifyUs[BOOT_SLOT_COUNT];
+	uint8_t 					selected;
+	uint8_t 					pinned;				/* pin honoured, BOOT_SLOT_NONE if none	*/
+
+}Handle_Boot_Report_S;
+
+/* Variables ---------------------------------------------------------*/
+extern const Handle_Boot_SlotHeader_S Boot_SlotHeader;
+extern Handle_Boot_Report_S Boot_Report;
+
+/* Function prototypes -----------------------------------------------*/
+uint8_t Boot_SlotRunning(void);
+uint32_t Boot_SlotAddress(uint8_t slot);
+const Handle_Boot_SlotHeader_S *Boot_SlotGetHeader(uint8_t slot);
+void Boot_CrcBegin(void);
+void Boot_CrcFeed(const uint32_t *data, uint32_t words);
+uint32_t Boot_CrcEnd(void);
+Handle_Boot_SlotStatus_E Boot_SlotVerify(uint8_t slot);
+uint8_t Boot_Select(uint8_t runningSlot);
+void Boot_ConfirmSlot(uint8_t slot);
+void Boot_SlotPin(uint8_t slot);
+void Boot_EepromWrite(uint32_t address, uint32_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_BOOT_SLOT_H_ */
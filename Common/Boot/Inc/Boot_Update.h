@@ -0,0 +1,144 @@
+/*
+ * Boot_Update.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_BOOT_UPDATE_H_
+#define INC_BOOT_UPDATE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+/*
+ * Every host frame is BOOT_UPD_FRAME_SIZE bytes, so each half of the
+ * circular RX DMA buffer holds exactly one frame:
+ * 	[0xA5][type][seq:16][len:16][crc16:16][payload: 256]
+ * crc16 is CRC-16/CCITT-FALSE over the first 6 header bytes and the
+ * whole payload. Replies are a bare 8 byte header, len carries status.
+ */
+#define BOOT_UPD_SOF 					0xA5U
+#define BOOT_UPD_HEADER_SIZE 			8U
+#define BOOT_UPD_CHUNK_SIZE 			256U
+#define BOOT_UPD_FRAME_SIZE 			(BOOT_UPD_HEADER_SIZE + BOOT_UPD_CHUNK_SIZE)
+
+#define BOOT_UPD_BEGIN 					0x01U		/* payload: length, crc32, flags	*/
+#define BOOT_UPD_DATA 					0x02U		/* seq = chunk index			*/
+#define BOOT_UPD_END 					0x03U		/* verify the new image			*/
+#define BOOT_UPD_SWITCH 				0x04U		/* boot the new bank			*/
+#define BOOT_UPD_ACK 					0x81U		/* seq = next chunk expected	*/
+#define BOOT_UPD_NAK 					0x82U		/* seq = next chunk expected	*/
+
+/* BEGIN flags: payload is a Boot_Delta patch against the running image */
+#define BOOT_UPD_FLAG_DELTA 			0x01U
+
+/* Resume point saved to data EEPROM every this many chunks */
+#define BOOT_UPD_SAVE_CHUNKS 			16U
+#define BOOT_UPD_STATE_ADDRESS 			(DATA_EEPROM_BASE + 0x40UL)
+#define BOOT_UPD_STATE_MAGIC 			0x55504454UL		/* "UPDT" */
+
+/* Line quiet time before the receiver is re-armed after an error */
+#define BOOT_UPD_RESYNC_MS 				5U
+/* Session dropped (resume point kept) after this much silence */
+#define BOOT_UPD_TIMEOUT_MS 			10000U
+
+/* New image bytes a delta chunk may write per service call (~77 ms) */
+#define BOOT_UPD_DELTA_STEP 			1024U
+/* BUSY ACK interval while a delta chunk is still being applied */
+#define BOOT_UPD_BUSY_MS 				1000U
+
+/* USART2_RX on DMA1 channel 5 */
+#define BOOT_UPD_DMA_CHANNEL 			DMA1_Channel5
+#define BOOT_UPD_DMA_REQUEST 			DMA_REQUEST_4
+#define BOOT_UPD_DMA_IRQn 				DMA1_Channel4_5_6_7_IRQn
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef enum {
+	BootUpdOk = 0,
+	BootUpdBadFrame,
+	BootUpdBadState,
+	BootUpdBadLength,
+	BootUpdGap,
+	BootUpdOverrun,
+	BootUpdFlashError,
+	BootUpdBadImage,
+	BootUpdBusy,						/* keep-alive: chunk still applying	*/
+
+}Handle_Boot_UpdStatus_E;
+
+typedef enum {
+	BootUpdIdle = 0,
+	BootUpdErasing,
+	BootUpdReceiving,
+
+}Handle_Boot_UpdState_E;
+
+typedef struct {
+	uint8_t 	sof;
+	uint8_t 	type;
+	uint16_t 	seq;
+	uint16_t 	len;
+	uint16_t 	crc;
+
+}Handle_Boot_UpdHeader_S;
+
+/*
+ * @brief Resume point in data EEPROM. Chunks from chunksDone on may be
+ * 	half written (at most BOOT_UPD_SAVE_CHUNKS of them), so a resume
+ * 	erases those pages again before it asks for chunksDone.
+ */
+typedef struct {
+	uint32_t 	magic;
+	uint32_t 	imageCrc;
+	uint32_t 	length;
+	uint32_t 	chunksDone;
+	uint32_t 	bank;				/* BOOT_BANK1 / BOOT_BANK2 written	*/
+
+}Handle_Boot_UpdResume_S;
+
+typedef struct {
+	Handle_Boot_UpdState_E 	state;
+	uint8_t 				resync;				/* draining the line after an error	*/
+	uint8_t 				delta;				/* chunks are patch, not image		*/
+	uint32_t 				length;
+	uint32_t 				imageCrc;
+	uint16_t 				chunks;				/* chunks in the image				*/
+	uint16_t 				expected;			/* next chunk to program			*/
+	uint16_t 				patchLen;			/* delta chunk held, 0 when none	*/
+	uint16_t 				patchPos;			/* bytes of it applied				*/
+	uint32_t 				busyTick;			/* last BUSY ACK					*/
+	volatile uint32_t 		rxFrames;			/* frames completed by the DMA		*/
+	uint32_t 				doneFrames;			/* frames processed					*/
+	uint32_t 				lastRxTick;
+	uint32_t 				startTick;
+	uint32_t 				nakCount;
+	uint32_t 				bytesPerSec;		/* of the last completed update		*/
+
+}Handle_Boot_Update_S;
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_Boot_Update_S Boot_Update;
+
+/* Function prototypes -----------------------------------------------*/
+void Boot_UpdateInit(UART_HandleTypeDef *huart);
+void Boot_UpdateService(void);
+uint8_t Boot_UpdateActive(void);
+void Boot_UpdateDmaIRQHandler(void);
+uint16_t Boot_UpdCrc16(uint16_t crc, const uint8_t *data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_BOOT_UPDATE_H_ */
@@ -0,0 +1,237 @@
+/*
+ * Clock_Profile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Runtime switching between named clock profiles. The switch is done
+ *  on the registers with interrupts masked, because the HAL oscillator
+ *  calls time out on a SysTick that is being retimed at the same time.
+ *  The order follows RM0367: raise the voltage range before the clock
+ *  goes up, add wait states before the faster clock is selected, and
+ *  take both back down only after the slower clock runs. SysTick,
+ *  USART BRR and the timer reload then follow the new HCLK. A USART
+ *  clocked from HSI16 (RCC_CCIPR) is left running untouched: its BRR
+ *  does not depend on the profile, so no received byte is lost.
+ *
+ *  Shared by L0_APP1, L0_APP2 and RF433_Receiver: each project has
+ *  Common/STM32L0 as a source folder and Common/STM32L0/Inc on its
+ *  include path, and provides its own main.h.
+ *
+ *  Masked time is mostly PLL lock, about 0.2 ms. Switch between radio
+ *  messages: the RH_ASK tick pauses for that long.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Clock_Profile.h"
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	uint32_t 	hz;
+	uint32_t 	vos;					/* PWR_CR_VOS value					*/
+	uint32_t 	latency;				/* FLASH_ACR_LATENCY or 0			*/
+	uint32_t 	sw;						/* RCC_CFGR_SW value				*/
+
+}Handle_Clock_Cfg_S;
+
+/* Variables -----------------------------------------------------------------*/
+Handle_Clock_S Clock_S = { ClockBoot, NULL, NULL, 0 };
+
+/* Indexed by profile - ClockPerformance */
+static const Handle_Clock_Cfg_S Clock_Cfg[] = {
+	{ 32000000UL, 	PWR_CR_VOS_0, 				 FLASH_ACR_LATENCY, RCC_CFGR_SW_PLL },
+	{ 16000000UL, 	PWR_CR_VOS_0, 				 0U, 				RCC_CFGR_SW_HSI },
+	{ CLOCK_MSI_HZ, PWR_CR_VOS_0 | PWR_CR_VOS_1, 0U, 				RCC_CFGR_SW_MSI },
+};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Change the regulator range and wait until it is stable.
+ * @param : vos - PWR_CR_VOS value; range 1 = VOS_0, range 3 = VOS_0|VOS_1
+ * @retval : none
+ */
+static void Clock_SetRange(uint32_t vos)
+{
+	__HAL_RCC_PWR_CLK_ENABLE();
+	MODIFY_REG(PWR->CR, PWR_CR_VOS, vos);
+	while (PWR->CSR & PWR_CSR_VOSF) {
+	}
+}
+
+/*
+ * @brief : Select the system clock source and wait for the switch.
+ * @param : sw - RCC_CFGR_SW value
+ * @retval : none
+ */
+static void Clock_SelectSysclk(uint32_t sw)
+{
+	MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, sw);
+	while ((RCC->CFGR & RCC_CFGR_SWS) != (sw << RCC_CFGR_SWS_Pos)) {
+	}
+}
+
+/*
+ * @brief : The USART's kernel clock is PCLK or SYSCLK, so its BRR must
+ * 			follow the profile. HSI16 or LSE (CCIPR xSEL bit 1) do not.
+ * @param : usart - USART1, USART2 or LPUART1
+ * @retval : 1 when BRR has to be rewritten on a switch
+ */
+static uint8_t Clock_UartOnHclk(const USART_TypeDef *usart)
+{
+	if (usart == USART1) {
+		return !(RCC->CCIPR & RCC_CCIPR_USART1SEL_1);
+	}
+	if (usart == USART2) {
+		return !(RCC->CCIPR & RCC_CCIPR_USART2SEL_1);
+	}
+	return !(RCC->CCIPR & RCC_CCIPR_LPUART1SEL_1);
+}
+
+/*
+ * @brief : Register the peripherals whose timing follows HCLK.
+ * @param : huart - console/update UART, or NULL
+ * 			tim   - timer whose update rate must stay at timHz, or NULL
+ * 			timHz - update rate, e.g. the 16 kHz RH_ASK tick
+ * @retval : none
+ */
+void Clock_ProfileInit(UART_HandleTypeDef *huart, TIM_TypeDef *tim, uint32_t timHz)
+{
+	Clock_S.huart = huart;
+	Clock_S.tim   = tim;
+	Clock_S.timHz = timHz;
+}
+
+/*
+ * @brief : Switch to a clock profile.
+ * @param : profile - ClockPerformance / ClockNominal / ClockLowPower
+ * @retval : HAL_OK, HAL_ERROR for ClockBoot or an unknown profile
+ */
+HAL_StatusTypeDef Clock_ProfileSet(Handle_Clock_Profile_E profile)
+{
+	const Handle_Clock_Cfg_S *cfg;
+	USART_TypeDef *usart = NULL;
+	uint32_t primask, dmat = 0;
+
+	if ((profile == ClockBoot) || (profile > ClockLowPower)) {
+		return HAL_ERROR;
+	}
+	if (profile == Clock_S.profile) {
+		return HAL_OK;
+	}
+	cfg = &Clock_Cfg[profile - ClockPerformance];
+
+	/* Only a USART on HCLK is stopped and retimed */
+	if ((Clock_S.huart != NULL) && Clock_UartOnHclk(Clock_S.huart->Instance)) {
+		usart = Clock_S.huart->Instance;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	/* Hold off TX DMA and let the byte in the shift register finish */
+	if (usart != NULL) {
+		dmat = usart->CR3 & USART_CR3_DMAT;
+		CLEAR_BIT(usart->CR3, USART_CR3_DMAT);
+		while (!(usart->ISR & USART_ISR_TC)) {
+		}
+	}
+
+	/* Larger VOS value = lower range; go up first */
+	if (cfg->vos < (PWR->CR & PWR_CR_VOS)) {
+		Clock_SetRange(cfg->vos);
+	}
+
+	/* Target oscillator running, off HSI16 if the PLL is about to change */
+	if (cfg->sw == RCC_CFGR_SW_MSI) {
+		MODIFY_REG(RCC->ICSCR, RCC_ICSCR_MSIRANGE, RCC_ICSCR_MSIRANGE_5);
+		SET_BIT(RCC->CR, RCC_CR_MSION);
+		while (!(RCC->CR & RCC_CR_MSIRDY)) {
+		}
+	} else {
+		SET_BIT(RCC->CR, RCC_CR_HSION);
+		while (!(RCC->CR & RCC_CR_HSIRDY)) {
+		}
+		if ((RCC->CFGR & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL) {
+			Clock_SelectSysclk(RCC_CFGR_SW_HSI);
+		}
+	}
+	if (cfg->sw == RCC_CFGR_SW_PLL) {
+		CLEAR_BIT(RCC->CR, RCC_CR_PLLON);
+		while (RCC->CR & RCC_CR_PLLRDY) {
+		}
+		MODIFY_REG(RCC->CFGR, RCC_CFGR_PLLSRC | RCC_CFGR_PLLMUL | RCC_CFGR_PLLDIV,
+				RCC_CFGR_PLLSRC_HSI | RCC_CFGR_PLLMUL4 | RCC_CFGR_PLLDIV2);
+		SET_BIT(RCC->CR, RCC_CR_PLLON);
+		while (!(RCC->CR & RCC_CR_PLLRDY)) {
+		}
+	}
+
+	/* AHB/APB prescalers stay at 1, so PCLK1 = HCLK */
+	MODIFY_REG(RCC->CFGR, RCC_CFGR_HPRE | RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2, 0U);
+
+	if (cfg->latency) {
+		SET_BIT(FLASH->ACR, FLASH_ACR_LATENCY);
+		while (!(FLASH->ACR & FLASH_ACR_LATENCY)) {
+		}
+	}
+	Clock_SelectSysclk(cfg->sw);
+	if (!cfg->latency) {
+		CLEAR_BIT(FLASH->ACR, FLASH_ACR_LATENCY);
+	}
+
+	/* Oscillators nobody uses any more */
+	if (cfg->sw != RCC_CFGR_SW_PLL) {
+		CLEAR_BIT(RCC->CR, RCC_CR_PLLON);
+	}
+	if (cfg->sw == RCC_CFGR_SW_MSI) {
+		/* HSI16 stays on for a USART clocked from it */
+		if ((Clock_S.huart == NULL) || (usart != NULL)) {
+			CLEAR_BIT(RCC->CR, RCC_CR_HSION);
+		}
+	} else {
+		CLEAR_BIT(RCC->CR, RCC_CR_MSION);
+	}
+
+	if (cfg->vos > (PWR->CR & PWR_CR_VOS)) {
+		Clock_SetRange(cfg->vos);
+	}
+
+	/* SysTick keeps its 1 ms period; uwTick carries on */
+	SystemCoreClock = cfg->hz;
+	HAL_InitTick(TICK_INT_PRIORITY);
+
+	if (usart != NULL) {
+		uint32_t baud = Clock_S.huart->Init.BaudRate;
+
+		/* BRR is only writable with the USART disabled; DMA and IE bits stay */
+		CLEAR_BIT(usart->CR1, USART_CR1_UE);
+		usart->BRR = (cfg->hz + (baud / 2U)) / baud;
+		SET_BIT(usart->CR1, USART_CR1_UE);
+		SET_BIT(usart->CR3, dmat);
+	}
+
+	if (Clock_S.tim != NULL) {
+		Clock_S.tim->PSC = 0;
+		Clock_S.tim->ARR = ((cfg->hz + (Clock_S.timHz / 2U)) / Clock_S.timHz) - 1U;
+		/* Load PSC now without raising an update interrupt */
+		SET_BIT(Clock_S.tim->CR1, TIM_CR1_URS);
+		Clock_S.tim->EGR = TIM_EGR_UG;
+		CLEAR_BIT(Clock_S.tim->CR1, TIM_CR1_URS);
+	}
+
+	Clock_S.profile = profile;
+	__set_PRIMASK(primask);
+
+	return HAL_OK;
+}
+
+/*
+ * @brief : Current profile.
+ * @param : none
+ * @retval : Handle_Clock_Profile_E
+ */
+Handle_Clock_Profile_E Clock_ProfileGet(void)
+{
+	return Clock_S.profile;
+}
@@ -0,0 +1,286 @@
+/*
+ * Console.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  DMA driven UART output. Text is copied into a RAM ring and a DMA
+ *  channel sends it, one contiguous run per transfer, the next run
+ *  started from the transfer complete interrupt. Printing costs a
+ *  memcpy instead of 87 us per character at 115200.
+ *
+ *  Any context may write, interrupts included. A writer reserves its
+ *  bytes and then copies them with interrupts enabled; the DMA only
+ *  sends up to the point where every open reservation has been
+ *  committed. The M0+ has no LDREX/STREX, so reserve and commit are
+ *  a few instructions with PRIMASK set.
+ *
+ *  Only the TX side of the USART is touched here; RX, if used, stays
+ *  with its owner (Boot_Update's HAL DMA on the L0 apps). _write() is
+ *  routed here, so printf() from the main loop does not block either.
+ *  newlib's printf is not reentrant: interrupts, the RH_ASK tick on
+ *  RF433_Receiver included, use Console_Write()/Console_Printf().
+ *
+ *  The DMA channel, request and interrupt come from the project's
+ *  main.h, see Console.h.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Console.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Define --------------------------------------------------------------------*/
+#define CONSOLE_MASK 					(CONSOLE_SIZE - 1U)
+#define CONSOLE_ERRORS 					(USART_ICR_ORECF | USART_ICR_FECF | USART_ICR_NCF | USART_ICR_PECF)
+
+/* Variables -----------------------------------------------------------------*/
+static DMA_HandleTypeDef 	hdma_con_tx;
+static USART_TypeDef 		*Con_uart = NULL;
+static uint8_t 				Con_buf[CONSOLE_SIZE];
+static volatile uint16_t 	Con_head = 0;		/* next byte to reserve			*/
+static volatile uint16_t 	Con_commit = 0;		/* bytes before this are written*/
+static volatile uint16_t 	Con_tail = 0;		/* next byte for the DMA		*/
+static volatile uint16_t 	Con_dmaLen = 0;		/* running transfer, 0 = idle	*/
+static volatile uint8_t 	Con_writers = 0;	/* reservations not committed	*/
+static uint16_t 			Con_highWater = 0;
+static uint32_t 			Con_dropped = 0;
+
+/* Function prototypes -------------------------------------------------------*/
+static void Con_DmaDone(DMA_HandleTypeDef *hdma);
+
+/*
+ * @brief : Start the next contiguous run if the DMA is idle.
+ * 			Called with interrupts masked.
+ * @param : none
+ * @retval : none
+ */
+static void Con_Kick(void)
+{
+	uint16_t end;
+
+	if ((Con_dmaLen != 0U) || (Con_commit == Con_tail)) {
+		return;
+	}
+	end = (Con_commit > Con_tail) ? Con_commit : (uint16_t)CONSOLE_SIZE;
+	Con_dmaLen = (uint16_t)(end - Con_tail);
+
+	HAL_DMA_Start_IT(&hdma_con_tx, (uint32_t)&Con_buf[Con_tail], (uint32_t)&Con_uart->TDR, Con_dmaLen);
+}
+
+/*
+ * @brief : Take over the TX side of an initialised UART.
+ * @param : huart - UART handle, matching CONSOLE_DMA_REQUEST
+ * @retval : none
+ */
+void Console_Init(UART_HandleTypeDef *huart)
+{
+	Con_uart = huart->Instance;
+	Con_head = Con_commit = Con_tail = 0;
+	Con_dmaLen = 0;
+	Con_writers = 0;
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	hdma_con_tx.Instance 					= CONSOLE_DMA_CHANNEL;
+	hdma_con_tx.Init.Request 				= CONSOLE_DMA_REQUEST;
+	hdma_con_tx.Init.Direction 				= DMA_MEMORY_TO_PERIPH;
+	hdma_con_tx.Init.PeriphInc 				= DMA_PINC_DISABLE;
+	hdma_con_tx.Init.MemInc 				= DMA_MINC_ENABLE;
+	hdma_con_tx.Init.PeriphDataAlignment 	= DMA_PDATAALIGN_BYTE;
+	hdma_con_tx.Init.MemDataAlignment 		= DMA_MDATAALIGN_BYTE;
+	hdma_con_tx.Init.Mode 					= DMA_NORMAL;
+	hdma_con_tx.Init.Priority 				= DMA_PRIORITY_LOW;
+	if (HAL_DMA_Init(&hdma_con_tx) != HAL_OK) {
+		Error_Handler();
+	}
+	hdma_con_tx.XferCpltCallback = Con_DmaDone;
+
+	SET_BIT(Con_uart->CR3, USART_CR3_DMAT);
+
+	HAL_NVIC_SetPriority(CONSOLE_DMA_IRQn, CONSOLE_DMA_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(CONSOLE_DMA_IRQn);
+
+#ifdef CONSOLE_UART_IRQn
+	/* Still needed for the RX error flags, see Console_IRQHandler() */
+	HAL_NVIC_SetPriority(CONSOLE_UART_IRQn, CONSOLE_UART_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(CONSOLE_UART_IRQn);
+#endif
+}
+
+/*
+ * @brief : Queue bytes for transmission; never blocks, any context.
+ * @param : data - bytes to send
+ * 			len  - byte count
+ * @retval : bytes queued, the rest is dropped when the ring is full
+ */
+uint16_t Console_Write(const char *data, uint16_t len)
+{
+	uint32_t primask;
+	uint16_t pos, used, n, first;
+
+	if (Con_uart == NULL) {
+		return 0;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	used = (uint16_t)((Con_head - Con_tail) & CONSOLE_MASK);
+	n = (uint16_t)(CONSOLE_MASK - used);
+	if (n > len) {
+		n = len;
+	}
+	Con_dropped += (uint32_t)(len - n);
+	if ((uint16_t)(used + n) > Con_highWater) {
+		Con_highWater = (uint16_t)(used + n);
+	}
+	pos = Con_head;
+	Con_head = (uint16_t)((pos + n) & CONSOLE_MASK);
+	Con_writers++;
+	__set_PRIMASK(primask);
+
+	first = (uint16_t)(CONSOLE_SIZE - pos);
+	if (first > n) {
+		first = n;
+	}
+	memcpy(&Con_buf[pos], data, first);
+	memcpy(Con_buf, data + first, n - first);
+
+	__disable_irq();
+	if (--Con_writers == 0U) {
+		Con_commit = Con_head;
+	}
+	Con_Kick();
+	__set_PRIMASK(primask);
+
+	return n;
+}
+
+/*
+ * @brief : printf into the TX ring, lines longer than CONSOLE_LINE are cut.
+ * @param : fmt - format string
+ * @retval : none
+ */
+void Console_Printf(const char *fmt, ...)
+{
+	char line[CONSOLE_LINE];
+	va_list args;
+	int len;
+
+	va_start(args, fmt);
+	len = vsnprintf(line, sizeof(line), fmt, args);
+	va_end(args);
+
+	if (len > 0) {
+		Console_Write(line, (len < (int)sizeof(line)) ? (uint16_t)len : (uint16_t)(sizeof(line) - 1U));
+	}
+}
+
+/*
+ * @brief : Wait until everything queued has left the shift register.
+ * 			Used before a reset that would cut the output short.
+ * 			Needs the DMA interrupt, so not with interrupts masked.
+ * @param : none
+ * @retval : none
+ */
+void Console_Flush(void)
+{
+	if (Con_uart == NULL) {
+		return;
+	}
+	while ((Con_tail != Con_commit) || (Con_dmaLen != 0U)) {
+	}
+	while (!(Con_uart->ISR & USART_ISR_TC)) {
+	}
+}
+
+/*
+ * @brief : Bytes Console_Write() would take now without dropping any.
+ * @param : none
+ * @retval : free space in the ring
+ */
+uint16_t Console_Free(void)
+{
+	return (uint16_t)(CONSOLE_MASK - ((Con_head - Con_tail) & CONSOLE_MASK));
+}
+
+/*
+ * @brief : Bytes lost because the ring was full.
+ * @param : none
+ * @retval : dropped byte count
+ */
+uint32_t Console_Dropped(void)
+{
+	return Con_dropped;
+}
+
+/*
+ * @brief : Most bytes the ring has held at once since Console_Init().
+ * @param : none
+ * @retval : high-water mark, CONSOLE_SIZE - 1 at most
+ */
+uint16_t Console_HighWater(void)
+{
+	return Con_highWater;
+}
+
+/*
+ * @brief : USART interrupt, for a project that sets CONSOLE_UART_IRQn.
+ * 			Only RX errors are left to handle: the HAL enables their
+ * 			interrupt for a DMA receiver, which resynchronises on its
+ * 			own (Boot_Update).
+ * @param : none
+ * @retval : none
+ */
+void Console_IRQHandler(void)
+{
+	if (Con_uart->ISR & (USART_ISR_ORE | USART_ISR_FE | USART_ISR_NE | USART_ISR_PE)) {
+		Con_uart->ICR = CONSOLE_ERRORS;
+	}
+}
+
+/*
+ * @brief : TX DMA interrupt, called from the CONSOLE_DMA_IRQn handler.
+ * @param : none
+ * @retval : none
+ */
+void Console_DmaIRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&hdma_con_tx);
+}
+
+/*
+ * @brief : Run sent: release it and chain the next one.
+ */
+static void Con_DmaDone(DMA_HandleTypeDef *hdma)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	(void)hdma;
+	__disable_irq();
+	Con_tail = (uint16_t)((Con_tail + Con_dmaLen) & CONSOLE_MASK);
+	Con_dmaLen = 0;
+	Con_Kick();
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief : newlib output hook, replaces the weak one in syscalls.c.
+ * 			Reports every byte as written so newlib never retries on a
+ * 			full ring; the shortfall shows in Console_Dropped().
+ */
+int _write(int file, char *ptr, int len)
+{
+	int left = len;
+
+	(void)file;
+	while (left > 0) {
+		uint16_t n = (left > 0x7FFF) ? 0x7FFFU : (uint16_t)left;
+
+		Console_Write(ptr, n);
+		ptr += n;
+		left -= n;
+	}
+	return len;
+}
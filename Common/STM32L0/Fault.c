@@ -0,0 +1,165 @@
+/*
+ * Fault.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  HardFault post-mortem. HardFault_Handler() is defined here, not in
+ *  stm32l0xx_it.c (its generation is off in the .ioc). It passes the
+ *  exception frame to Fault_Capture(), which copies the stacked registers, the words of
+ *  stack above them and how long each supervisor task has been silent
+ *  into a .noinit record, then resets through Wdg_Reset() so the
+ *  watchdog record says "fault" as well. The next boot prints the record
+ *  as FAULT lines; Tools/fault_decode.py turns the addresses into
+ *  functions and source lines from the ELF. Cortex-M0+ has no fault
+ *  status registers, so the frame and the stack are all there is.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "Fault.h"
+#include "Watchdog.h"
+
+/* Define --------------------------------------------------------------------*/
+#define FAULT_XPSR_ALIGN 				(1UL << 9)	/* frame was padded to 8 bytes	*/
+#define FAULT_STACK_PER_LINE 			4U
+
+/* Variables -----------------------------------------------------------------*/
+Handle_Fault_Record_S Fault_Last;
+
+static Handle_Fault_Record_S Fault_Record __attribute__((section(".noinit.fault")));
+
+extern uint8_t _estack;
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : HardFault entry. Naked, so SP still points at the exception
+ * 			frame: pick MSP or PSP as EXC_RETURN bit 2 says and hand the
+ * 			frame and EXC_RETURN to Fault_Capture(), which never returns.
+ * @param : none
+ * @retval : none
+ */
+__attribute__((naked, noreturn)) void HardFault_Handler(void)
+{
+	__asm volatile (
+		"movs r0, #4		\n"
+		"mov r1, lr			\n"
+		"tst r0, r1			\n"
+		"bne 1f				\n"
+		"mrs r0, msp		\n"
+		"b 2f				\n"
+		"1:					\n"
+		"mrs r0, psp		\n"
+		"2:					\n"
+		"bl Fault_Capture	\n"
+	);
+}
+
+/*
+ * @brief : Take over the record left by a fault in the previous run.
+ * 			Call early in main().
+ * @param : none
+ * @retval : previous record, NULL if the last reset was not a fault
+ */
+const Handle_Fault_Record_S *Fault_Init(void)
+{
+	if (Fault_Record.magic != FAULT_RECORD_MAGIC) {
+		return NULL;
+	}
+
+	Fault_Last = Fault_Record;
+	Fault_Record.magic = 0;
+	return &Fault_Last;
+}
+
+/*
+ * @brief : Record the fault and reset, from HardFault_Handler() with SP
+ * 			untouched. The frame is only trusted inside RAM: a fault on a
+ * 			corrupted SP still leaves excReturn, sp and the task state.
+ * @param : frame     - exception frame, MSP or PSP as excReturn says
+ * 			excReturn - LR on HardFault entry
+ * @retval : none
+ */
+void Fault_Capture(const uint32_t *frame, uint32_t excReturn)
+{
+	uint32_t top = (uint32_t)&_estack;
+	uint32_t addr = (uint32_t)frame;
+	uint32_t now = HAL_GetTick();
+	uint32_t silent;
+	uint8_t i, n = 0;
+
+	__disable_irq();
+
+	memset(&Fault_Record, 0, sizeof(Fault_Record));
+	Fault_Record.excReturn = excReturn;
+	Fault_Record.sp 	   = addr;
+
+	if ((addr >= SRAM_BASE) && ((addr & 3U) == 0U) && ((addr + sizeof(Handle_Fault_Frame_S)) <= top)) {
+		memcpy(&Fault_Record.frame, frame, sizeof(Handle_Fault_Frame_S));
+
+		/* SP before the core stacked the frame */
+		addr += sizeof(Handle_Fault_Frame_S);
+		if (Fault_Record.frame.xpsr & FAULT_XPSR_ALIGN) {
+			addr += 4U;
+		}
+		Fault_Record.sp = addr;
+
+		while ((n < FAULT_STACK_WORDS) && ((addr + 4U) <= top)) {
+			Fault_Record.stack[n++] = *(const uint32_t *)addr;
+			addr += 4U;
+		}
+	}
+	Fault_Record.stackWords = n;
+
+	Fault_Record.uptimeMs = now;
+	for (i = 0; (i < Wdg.tasks) && (i < FAULT_TASKS); i++) {
+		silent = now - Wdg.task[i].lastMs;
+		Fault_Record.taskSilentMs[i] = (silent > 0xFFFFU) ? 0xFFFFU : (uint16_t)silent;
+	}
+	Fault_Record.tasks = i;
+
+	Fault_Record.magic = FAULT_RECORD_MAGIC;
+
+	Wdg_Reset(WdgReasonFault, Fault_Record.frame.pc);
+}
+
+/*
+ * @brief : Print a record as FAULT lines, the format Tools/fault_decode.py
+ * 			reads. Task names come from this run's Wdg_Register() calls,
+ * 			which are made in the same order on every boot.
+ * @param : rec  - from Fault_Init()
+ * 			line - prints one line, adding its own line end
+ * @retval : none
+ */
+void Fault_Report(const Handle_Fault_Record_S *rec, Fault_Line_F line)
+{
+	char buf[FAULT_LINE];
+	const Handle_Fault_Frame_S *f = &rec->frame;
+	uint32_t len;
+	uint8_t i, k;
+
+	snprintf(buf, sizeof(buf), "FAULT pc %08lx lr %08lx xpsr %08lx exc %08lx sp %08lx ms %lu",
+			f->pc, f->lr, f->xpsr, rec->excReturn, rec->sp, rec->uptimeMs);
+	line(buf);
+
+	snprintf(buf, sizeof(buf), "FAULT r0 %08lx r1 %08lx r2 %08lx r3 %08lx r12 %08lx",
+			f->r0, f->r1, f->r2, f->r3, f->r12);
+	line(buf);
+
+	len = (uint32_t)snprintf(buf, sizeof(buf), "FAULT tasks");
+	for (i = 0; (i < rec->tasks) && (len < sizeof(buf)); i++) {
+		len += (uint32_t)snprintf(&buf[len], sizeof(buf) - len, " %s=%u",
+				(i < Wdg.tasks) ? Wdg.task[i].name : "?", rec->taskSilentMs[i]);
+	}
+	line(buf);
+
+	for (i = 0; i < rec->stackWords; i += FAULT_STACK_PER_LINE) {
+		len = (uint32_t)snprintf(buf, sizeof(buf), "FAULT stack %08lx", rec->sp + 4U * i);
+		for (k = i; (k < rec->stackWords) && (k < i + FAULT_STACK_PER_LINE); k++) {
+			len += (uint32_t)snprintf(&buf[len], sizeof(buf) - len, " %08lx", rec->stack[k]);
+		}
+		line(buf);
+	}
+}
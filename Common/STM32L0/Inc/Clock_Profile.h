@@ -0,0 +1,62 @@
+/*
+ * Clock_Profile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_CLOCK_PROFILE_H_
+#define INC_CLOCK_PROFILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define CLOCK_MSI_HZ 					2097000UL	/* MSI range 5				*/
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief Named system clock profiles
+ */
+typedef enum
+{
+	ClockBoot = 0,						/* left by SystemClock_Config()		*/
+	ClockPerformance,					/* PLL 32 MHz, range 1, 1 WS		*/
+	ClockNominal,						/* HSI16 16 MHz, range 1, 0 WS		*/
+	ClockLowPower,						/* MSI 2.097 MHz, range 3, 0 WS		*/
+
+} Handle_Clock_Profile_E;
+
+/*
+ * @brief Peripherals retimed on every switch
+ */
+typedef struct {
+	Handle_Clock_Profile_E 	profile;
+	UART_HandleTypeDef 		*huart;		/* BRR from Init.BaudRate if on HCLK	*/
+	TIM_TypeDef 			*tim;		/* update rate kept at timHz		*/
+	uint32_t 				timHz;
+
+}Handle_Clock_S;
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_Clock_S Clock_S;
+
+/* Function prototypes -----------------------------------------------*/
+void Clock_ProfileInit(UART_HandleTypeDef *huart, TIM_TypeDef *tim, uint32_t timHz);
+HAL_StatusTypeDef Clock_ProfileSet(Handle_Clock_Profile_E profile);
+Handle_Clock_Profile_E Clock_ProfileGet(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_CLOCK_PROFILE_H_ */
@@ -0,0 +1,57 @@
+/*
+ * Console.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_CONSOLE_H_
+#define INC_CONSOLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define CONSOLE_SIZE 					512U		/* TX ring, power of two	*/
+#define CONSOLE_LINE 					96U			/* longest printf line		*/
+
+/*
+ * Each project's main.h picks the TX DMA: CONSOLE_DMA_CHANNEL,
+ * CONSOLE_DMA_REQUEST, CONSOLE_DMA_IRQn and CONSOLE_DMA_PRIORITY.
+ * CONSOLE_UART_IRQn/CONSOLE_UART_PRIORITY are optional, for a UART whose
+ * RX error interrupt is left on (Console_IRQHandler()).
+ */
+#if !defined(CONSOLE_DMA_CHANNEL) || !defined(CONSOLE_DMA_REQUEST) \
+		|| !defined(CONSOLE_DMA_IRQn) || !defined(CONSOLE_DMA_PRIORITY)
+#error "Console.h: define the CONSOLE_DMA_* settings in main.h"
+#endif
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void Console_Init(UART_HandleTypeDef *huart);
+uint16_t Console_Write(const char *data, uint16_t len);
+void Console_Printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void Console_Flush(void);
+uint16_t Console_Free(void);
+uint32_t Console_Dropped(void);
+uint16_t Console_HighWater(void);
+void Console_IRQHandler(void);
+void Console_DmaIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_CONSOLE_H_ */
@@ -0,0 +1,80 @@
+/*
+ * Fault.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_FAULT_H_
+#define INC_FAULT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define FAULT_STACK_WORDS 				16U		/* RAM above the exception frame	*/
+#define FAULT_TASKS 					4U		/* supervisor tasks kept			*/
+#define FAULT_LINE 						96U		/* longest Fault_Report() line		*/
+
+#define FAULT_RECORD_MAGIC 				0x464C5431UL		/* "FLT1" */
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+
+/* Stacked by the core on exception entry, in this order */
+typedef struct {
+	uint32_t 	r0;
+	uint32_t 	r1;
+	uint32_t 	r2;
+	uint32_t 	r3;
+	uint32_t 	r12;
+	uint32_t 	lr;
+	uint32_t 	pc;
+	uint32_t 	xpsr;
+
+}Handle_Fault_Frame_S;
+
+/*
+ * @brief Post-mortem of the last HardFault. Kept in .noinit.fault, so it
+ * 	survives the reset that follows (not a power cycle); Fault_Init() on
+ * 	the next boot takes it and Fault_Report() prints it for
+ * 	Tools/fault_decode.py.
+ */
+typedef struct {
+	uint32_t 				magic;
+	Handle_Fault_Frame_S 	frame;
+	uint32_t 				excReturn;		/* LR on entry: stack and mode faulted in	*/
+	uint32_t 				sp;				/* SP of the faulting code				*/
+	uint32_t 				uptimeMs;
+	uint16_t 				taskSilentMs[FAULT_TASKS];	/* since each task's check-in	*/
+	uint8_t 				tasks;
+	uint8_t 				stackWords;		/* valid words in stack[]				*/
+	uint16_t 				reserved;
+	uint32_t 				stack[FAULT_STACK_WORDS];	/* from sp: locals, return addresses */
+
+}Handle_Fault_Record_S;
+
+typedef void (*Fault_Line_F)(const char *line);
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_Fault_Record_S Fault_Last;		/* previous run's record, or zeros */
+
+/* Function prototypes -----------------------------------------------*/
+void HardFault_Handler(void);
+const Handle_Fault_Record_S *Fault_Init(void);
+void Fault_Capture(const uint32_t *frame, uint32_t excReturn) __attribute__((noreturn));
+void Fault_Report(const Handle_Fault_Record_S *rec, Fault_Line_F line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FAULT_H_ */
@@ -0,0 +1,55 @@
+/*
+ * Ram_Usage.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_RAM_USAGE_H_
+#define INC_RAM_USAGE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define RAM_PAINT_WORD 					0xA5A5A5A5UL
+#define RAM_PAINT_GUARD 				64U			/* bytes left below SP		*/
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief RAM use in bytes. Sections absent from an image read 0.
+ */
+typedef struct {
+	uint32_t 	dataBytes;
+	uint32_t 	bssBytes;
+	uint32_t 	ramfuncBytes;
+	uint32_t 	poolBytes;
+	uint32_t 	noinitBytes;
+	uint32_t 	heapArena;				/* taken from _sbrk					*/
+	uint32_t 	heapUsed;				/* allocated by malloc				*/
+	uint32_t 	stackReserve;			/* _Min_Stack_Size					*/
+	uint32_t 	stackPeak;				/* deepest since Ram_StackPaint()	*/
+	uint32_t 	stackHeadroom;			/* never touched, heap to stack		*/
+
+}Handle_Ram_Usage_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void Ram_StackPaint(void);
+void Ram_UsageGet(Handle_Ram_Usage_S *usage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_RAM_USAGE_H_ */
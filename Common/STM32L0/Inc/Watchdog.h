@@ -0,0 +1,101 @@
+/*
+ * Watchdog.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_WATCHDOG_H_
+#define INC_WATCHDOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define WDG_TASKS_MAX 					8U
+#define WDG_CHECK_MS 					100U	/* supervisor period, SysTick	*/
+#define WDG_TASK_NONE 					0xFFU
+
+/* IWDG on LSI (37 kHz nominal, 26..56 kHz): /16 and ~1 s at 37 kHz */
+#define WDG_LSI_HZ 						37000U
+#define WDG_IWDG_PR 					2U		/* /16							*/
+#define WDG_IWDG_DIV 					16U
+#define WDG_TIMEOUT_MS 					1000U
+#define WDG_IWDG_RELOAD 				(((WDG_LSI_HZ / WDG_IWDG_DIV) * WDG_TIMEOUT_MS) / 1000U - 1U)
+
+#define WDG_RECORD_MAGIC 				0x57444731UL		/* "WDG1" */
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef enum {
+	WdgReasonNone = 0,
+	WdgReasonTaskLate,				/* a task missed its deadline		*/
+	WdgReasonError,					/* Error_Handler()					*/
+	WdgReasonFault,					/* HardFault						*/
+
+}Handle_Wdg_Reason_E;
+
+typedef struct {
+	const char 			*name;
+	uint32_t 			timeoutMs;
+	volatile uint32_t 	lastMs;			/* HAL tick of the last check-in	*/
+
+}Handle_Wdg_Task_S;
+
+/*
+ * @brief Why the supervisor let the chip reset. Kept in .noinit.wdg, so it
+ * 	survives the reset (not a power cycle) and Wdg_Init() on the next boot
+ * 	finds it. Tasks are registered in the same order on every boot, so
+ * 	the index names the task.
+ */
+typedef struct {
+	uint32_t 	magic;
+	uint8_t 	reason;					/* Handle_Wdg_Reason_E				*/
+	uint8_t 	task;					/* first late task, WDG_TASK_NONE	*/
+	uint16_t 	lateMask;				/* every task late at the time		*/
+	uint32_t 	silentMs;				/* since the first late task's check-in	*/
+	uint32_t 	uptimeMs;				/* HAL tick when recorded			*/
+	uint32_t 	address;				/* Error_Handler() caller			*/
+	uint32_t 	count;					/* supervised resets since power-on	*/
+
+}Handle_Wdg_Record_S;
+
+typedef struct {
+	Handle_Wdg_Task_S 	task[WDG_TASKS_MAX];
+	uint8_t 			tasks;
+	uint8_t 			started;
+	uint8_t 			tripped;		/* refresh stopped for good			*/
+	uint8_t 			ticks;
+	uint32_t 			refreshes;
+	uint32_t 			resets;			/* supervised resets since power-on	*/
+	uint32_t 			resetFlags;		/* RCC->CSR at Wdg_Init(), not cleared	*/
+
+}Handle_Wdg_S;
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_Wdg_S Wdg;
+extern Handle_Wdg_Record_S Wdg_Last;		/* previous run's record, or zeros */
+
+/* Function prototypes -----------------------------------------------*/
+const Handle_Wdg_Record_S *Wdg_Init(void);
+uint8_t Wdg_Register(const char *name, uint32_t timeoutMs);
+void Wdg_Start(void);
+void Wdg_CheckIn(uint8_t id);
+void Wdg_SetTimeout(uint8_t id, uint32_t timeoutMs);
+void Wdg_Tick(void);
+void Wdg_Reset(Handle_Wdg_Reason_E reason, uint32_t address) __attribute__((noreturn));
+const char *Wdg_ReasonName(uint8_t reason);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_WATCHDOG_H_ */
@@ -0,0 +1,79 @@
+/*
+ * Ram_Usage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Stack watermark and RAM accounting. Ram_StackPaint() fills the gap
+ *  between the heap and the stack with RAM_PAINT_WORD; Ram_UsageGet()
+ *  later finds the lowest word the stack has overwritten. Section sizes
+ *  come from the linker script symbols, heap use from newlib mallinfo().
+ *  Tools/map_report.py gives the per-module breakdown of the same
+ *  sections from the map file.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Ram_Usage.h"
+#include <malloc.h>
+
+/* Variables -----------------------------------------------------------------*/
+extern uint8_t _sdata, _edata, _sbss, _ebss;
+extern uint8_t _end, _estack, _Min_Stack_Size;
+
+/* Not in every image's linker script */
+extern uint8_t _sramfunc __attribute__((weak));
+extern uint8_t _eramfunc __attribute__((weak));
+extern uint8_t _spool __attribute__((weak));
+extern uint8_t _epool __attribute__((weak));
+extern uint8_t _snoinit __attribute__((weak));
+extern uint8_t _enoinit __attribute__((weak));
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Paint the free RAM between the heap and the current stack.
+ * 			Called early in main(), after the clock is up: at the reset
+ * 			clock the fill would add milliseconds to the boot. Frames
+ * 			deeper than main() before this call are not seen.
+ * @param : none
+ * @retval : none
+ */
+void Ram_StackPaint(void)
+{
+	struct mallinfo mi = mallinfo();
+	uint32_t *p = (uint32_t *)(((uint32_t)&_end + mi.arena + 3U) & ~3U);
+	uint32_t *top = (uint32_t *)((__get_MSP() - RAM_PAINT_GUARD) & ~3U);
+
+	while (p < top) {
+		*p++ = RAM_PAINT_WORD;
+	}
+}
+
+/*
+ * @brief : Current RAM use and the stack watermark.
+ * 			Scans the painted gap, a few thousand words: main loop only.
+ * @param : usage - filled in
+ * @retval : none
+ */
+void Ram_UsageGet(Handle_Ram_Usage_S *usage)
+{
+	struct mallinfo mi = mallinfo();
+	const uint32_t *heapEnd = (const uint32_t *)(((uint32_t)&_end + mi.arena + 3U) & ~3U);
+	const uint32_t *p = heapEnd;
+	const uint32_t *top = (const uint32_t *)&_estack;
+
+	usage->dataBytes    = (uint32_t)(&_edata - &_sdata);
+	usage->bssBytes     = (uint32_t)(&_ebss - &_sbss);
+	usage->ramfuncBytes = (uint32_t)&_eramfunc - (uint32_t)&_sramfunc;
+	usage->poolBytes    = (uint32_t)&_epool - (uint32_t)&_spool;
+	usage->noinitBytes  = (uint32_t)&_enoinit - (uint32_t)&_snoinit;
+	usage->heapArena    = mi.arena;
+	usage->heapUsed     = mi.uordblks;
+	usage->stackReserve = (uint32_t)&_Min_Stack_Size;
+
+	while ((p < top) && (*p == RAM_PAINT_WORD)) {
+		p++;
+	}
+	usage->stackPeak     = (uint32_t)top - (uint32_t)p;
+	usage->stackHeadroom = (uint32_t)p - (uint32_t)heapEnd;
+}
@@ -0,0 +1,219 @@
+/*
+ * Watchdog.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Task supervisor on the IWDG. Each task registers with a deadline and
+ *  checks in from its own code path; Wdg_Tick(), from SysTick, refreshes
+ *  the IWDG only while every task is within its deadline. The first late
+ *  task stops the refresh for good and is written to a .noinit record,
+ *  so the reset comes at most WDG_TIMEOUT_MS later and the next boot can
+ *  tell which task it was. A hang with interrupts off stops SysTick and
+ *  so the refresh as well. The IWDG is set up through its registers:
+ *  the HAL IWDG driver is not part of these projects.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Watchdog.h"
+
+/* Define --------------------------------------------------------------------*/
+#define WDG_KEY_REFRESH 				0xAAAAU
+#define WDG_KEY_UNLOCK 					0x5555U
+#define WDG_KEY_START 					0xCCCCU
+#define WDG_SR_WAIT 					10000U		/* PVU/RVU take ~5 LSI clocks */
+
+#if (WDG_IWDG_RELOAD > 0xFFFU)
+#error "WDG_TIMEOUT_MS too long for WDG_IWDG_PR"
+#endif
+
+/* Variables -----------------------------------------------------------------*/
+Handle_Wdg_S Wdg;
+Handle_Wdg_Record_S Wdg_Last;
+
+static Handle_Wdg_Record_S Wdg_Record __attribute__((section(".noinit.wdg")));
+
+static const char *const Wdg_ReasonNames[] = {
+	"none",
+	"task late",
+	"error",
+	"fault",
+};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Take over the record left by the previous run and arm a new
+ * 			one. Call early in main(), before anything can reset.
+ * @param : none
+ * @retval : previous record, NULL after a power cycle or a plain reset
+ */
+const Handle_Wdg_Record_S *Wdg_Init(void)
+{
+	uint32_t count = 0;
+
+	Wdg.resetFlags = RCC->CSR;
+
+	if ((Wdg_Record.magic == WDG_RECORD_MAGIC) && (Wdg_Record.reason <= WdgReasonFault)) {
+		count = Wdg_Record.count;
+		if (Wdg_Record.reason != WdgReasonNone) {
+			Wdg_Last = Wdg_Record;
+		}
+	}
+
+	Wdg_Record.magic 	= WDG_RECORD_MAGIC;
+	Wdg_Record.reason 	= WdgReasonNone;
+	Wdg_Record.task 	= WDG_TASK_NONE;
+	Wdg_Record.lateMask = 0;
+	Wdg_Record.count 	= count;
+	Wdg.resets 			= count;
+
+	return (Wdg_Last.reason != WdgReasonNone) ? &Wdg_Last : NULL;
+}
+
+/*
+ * @brief : Add a task; it counts as alive from now on.
+ * @param : name      - for the boot report
+ * 			timeoutMs - longest gap allowed between two check-ins
+ * @retval : task id for Wdg_CheckIn(), WDG_TASK_NONE when full
+ */
+uint8_t Wdg_Register(const char *name, uint32_t timeoutMs)
+{
+	Handle_Wdg_Task_S *task;
+
+	if (Wdg.tasks >= WDG_TASKS_MAX) {
+		return WDG_TASK_NONE;
+	}
+
+	task = &Wdg.task[Wdg.tasks];
+	task->name 		= name;
+	task->timeoutMs = timeoutMs;
+	task->lastMs 	= HAL_GetTick();
+	return Wdg.tasks++;
+}
+
+/*
+ * @brief : Start the IWDG. It cannot be stopped again, it keeps running
+ * 			through a software reset and is stopped by a core halt only.
+ * @param : none
+ * @retval : none
+ */
+void Wdg_Start(void)
+{
+	uint32_t wait = WDG_SR_WAIT;
+
+	__HAL_RCC_DBGMCU_CLK_ENABLE();
+	__HAL_DBGMCU_FREEZE_IWDG();
+
+	IWDG->KR  = WDG_KEY_START;
+	IWDG->KR  = WDG_KEY_UNLOCK;
+	IWDG->PR  = WDG_IWDG_PR;
+	IWDG->RLR = WDG_IWDG_RELOAD;
+	while ((IWDG->SR != 0U) && (--wait != 0U)) {
+	}
+	IWDG->KR  = WDG_KEY_REFRESH;
+
+	Wdg.started = 1;
+}
+
+/*
+ * @brief : The task is alive.
+ * @param : id - from Wdg_Register()
+ * @retval : none
+ */
+void Wdg_CheckIn(uint8_t id)
+{
+	if (id < Wdg.tasks) {
+		Wdg.task[id].lastMs = HAL_GetTick();
+	}
+}
+
+/*
+ * @brief : Change a task's deadline, e.g. for a phase whose passes are
+ * 			longer. Counts from the task's last check-in.
+ * @param : id        - from Wdg_Register()
+ * 			timeoutMs - new deadline
+ * @retval : none
+ */
+void Wdg_SetTimeout(uint8_t id, uint32_t timeoutMs)
+{
+	if (id < Wdg.tasks) {
+		Wdg.task[id].timeoutMs = timeoutMs;
+	}
+}
+
+/*
+ * @brief : Supervisor, from SysTick_Handler(). Every WDG_CHECK_MS, refresh
+ * 			the IWDG if no task is late; otherwise record the late tasks
+ * 			and never refresh again.
+ * @param : none
+ * @retval : none
+ */
+void Wdg_Tick(void)
+{
+	uint32_t now, silent, late = 0;
+	uint8_t i, first = WDG_TASK_NONE;
+
+	if (!Wdg.started || Wdg.tripped || (++Wdg.ticks < WDG_CHECK_MS)) {
+		return;
+	}
+	Wdg.ticks = 0;
+
+	now = HAL_GetTick();
+	for (i = 0; i < Wdg.tasks; i++) {
+		silent = now - Wdg.task[i].lastMs;
+		if (silent > Wdg.task[i].timeoutMs) {
+			late |= 1UL << i;
+			if (first == WDG_TASK_NONE) {
+				first = i;
+				Wdg_Record.silentMs = silent;
+			}
+		}
+	}
+
+	if (late == 0U) {
+		IWDG->KR = WDG_KEY_REFRESH;
+		Wdg.refreshes++;
+		return;
+	}
+
+	Wdg.tripped = 1;
+	Wdg_Record.reason 	= WdgReasonTaskLate;
+	Wdg_Record.task 	= first;
+	Wdg_Record.lateMask = (uint16_t)late;
+	Wdg_Record.uptimeMs = now;
+	Wdg_Record.address 	= 0;
+	Wdg_Record.count++;
+}
+
+/*
+ * @brief : Record why and reset now, instead of waiting for the IWDG.
+ * @param : reason  - Handle_Wdg_Reason_E
+ * 			address - code address to report, 0 if none
+ * @retval : none
+ */
+void Wdg_Reset(Handle_Wdg_Reason_E reason, uint32_t address)
+{
+	__disable_irq();
+
+	Wdg_Record.magic 	= WDG_RECORD_MAGIC;
+	Wdg_Record.reason 	= (uint8_t)reason;
+	Wdg_Record.task 	= WDG_TASK_NONE;
+	Wdg_Record.lateMask = 0;
+	Wdg_Record.silentMs = 0;
+	Wdg_Record.uptimeMs = HAL_GetTick();
+	Wdg_Record.address 	= address;
+	Wdg_Record.count++;
+
+	NVIC_SystemReset();
+}
+
+/*
+ * @brief : Printable reason
+ * @param : reason - Handle_Wdg_Reason_E
+ * @retval : name
+ */
+const char *Wdg_ReasonName(uint8_t reason)
+{
+	return (reason <= WdgReasonFault) ? Wdg_ReasonNames[reason] : "?";
+}
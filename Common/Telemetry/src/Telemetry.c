@@ -0,0 +1,182 @@
+/*
+ * Telemetry.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Binary telemetry records, COBS framed. Each byte is CRC'd and COBS
+ *  encoded as it is put, so there is no staging copy of the record: the
+ *  caller's buffer holds the finished frame, ready for a UART write.
+ *  Plain C without HAL calls; this one copy builds for the STM32 apps,
+ *  the ESP8285 sketch (as the Common/Telemetry Arduino library) and the
+ *  host benchmark (Tools/telemetry_bench.c).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "Telemetry.h"
+#include <string.h>
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Append one record byte: CRC, then COBS.
+ * @param : tlm - encoder
+ * 			b   - record byte
+ * @retval : none
+ */
+static void Tlm_Put(Handle_Tlm_S *tlm, uint8_t b)
+{
+	uint8_t i;
+
+	tlm->crc ^= (uint16_t)b << 8;
+	for (i = 0; i < 8U; i++) {
+		tlm->crc = (tlm->crc & 0x8000U) ? (uint16_t)((tlm->crc << 1) ^ 0x1021U) : (uint16_t)(tlm->crc << 1);
+	}
+
+	if (tlm->overflow || (tlm->pos >= tlm->size)) {
+		tlm->overflow = 1;
+		return;
+	}
+	if (b != 0U) {
+		tlm->buf[tlm->pos++] = b;
+		if (++tlm->code != 0xFFU) {
+			return;
+		}
+	}
+
+	/* A zero, or a full 254-byte block, closes the block */
+	tlm->buf[tlm->codePos] = tlm->code;
+	if (tlm->pos >= tlm->size) {
+		tlm->overflow = 1;
+		return;
+	}
+	tlm->codePos = tlm->pos++;
+	tlm->code = 1;
+}
+
+/*
+ * @brief : Append a little-endian value.
+ * @param : tlm - encoder
+ * 			v   - value
+ * 			n   - byte count
+ * @retval : none
+ */
+static void Tlm_PutLe(Handle_Tlm_S *tlm, uint32_t v, uint8_t n)
+{
+	while (n--) {
+		Tlm_Put(tlm, (uint8_t)v);
+		v >>= 8;
+	}
+}
+
+/*
+ * @brief : Start a record in buf.
+ * @param : tlm    - encoder
+ * 			buf    - output, TLM_ENCODED_MAX(record length) bytes
+ * 			size   - buf size
+ * 			type   - TLM_REC_x
+ * 			seq    - sender's record counter, gaps show lost frames
+ * 			timeMs - sender's timestamp
+ * @retval : none
+ */
+void Tlm_Begin(Handle_Tlm_S *tlm, uint8_t *buf, uint16_t size, uint8_t type, uint16_t seq, uint32_t timeMs)
+{
+	tlm->buf      = buf;
+	tlm->size     = size;
+	tlm->codePos  = 1;
+	tlm->pos      = 2;
+	tlm->code     = 1;
+	tlm->crc      = 0xFFFFU;
+	tlm->overflow = (size < 3U) ? 1U : 0U;
+
+	if (!tlm->overflow) {
+		buf[0] = 0x00;
+	}
+
+	Tlm_Put(tlm, type);
+	Tlm_PutLe(tlm, seq, 2);
+	Tlm_PutLe(tlm, timeMs, 4);
+}
+
+/*
+ * @brief : Typed fields.
+ * @param : tlm   - encoder
+ * 			id    - field ID for the record type, 0..31
+ * 			value - field value
+ * @retval : none
+ */
+void Tlm_PutU8(Handle_Tlm_S *tlm, uint8_t id, uint8_t value)
+{
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_U8 << 5) | (id & 0x1FU)));
+	Tlm_Put(tlm, value);
+}
+
+void Tlm_PutU16(Handle_Tlm_S *tlm, uint8_t id, uint16_t value)
+{
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_U16 << 5) | (id & 0x1FU)));
+	Tlm_PutLe(tlm, value, 2);
+}
+
+void Tlm_PutU32(Handle_Tlm_S *tlm, uint8_t id, uint32_t value)
+{
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_U32 << 5) | (id & 0x1FU)));
+	Tlm_PutLe(tlm, value, 4);
+}
+
+void Tlm_PutI16(Handle_Tlm_S *tlm, uint8_t id, int16_t value)
+{
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_I16 << 5) | (id & 0x1FU)));
+	Tlm_PutLe(tlm, (uint16_t)value, 2);
+}
+
+void Tlm_PutI32(Handle_Tlm_S *tlm, uint8_t id, int32_t value)
+{
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_I32 << 5) | (id & 0x1FU)));
+	Tlm_PutLe(tlm, (uint32_t)value, 4);
+}
+
+void Tlm_PutF32(Handle_Tlm_S *tlm, uint8_t id, float value)
+{
+	uint32_t bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_F32 << 5) | (id & 0x1FU)));
+	Tlm_PutLe(tlm, bits, 4);
+}
+
+/*
+ * @brief : Byte string field, e.g. a radio payload.
+ * @param : tlm  - encoder
+ * 			id   - field ID for the record type, 0..31
+ * 			data - bytes
+ * 			len  - byte count
+ * @retval : none
+ */
+void Tlm_PutBytes(Handle_Tlm_S *tlm, uint8_t id, const uint8_t *data, uint8_t len)
+{
+	Tlm_Put(tlm, (uint8_t)((TLM_KIND_BYTES << 5) | (id & 0x1FU)));
+	Tlm_Put(tlm, len);
+	while (len--) {
+		Tlm_Put(tlm, *data++);
+	}
+}
+
+/*
+ * @brief : Close the record: CRC, last COBS block, delimiter.
+ * @param : tlm - encoder
+ * @retval : frame length in buf, 0 if it did not fit
+ */
+uint16_t Tlm_End(Handle_Tlm_S *tlm)
+{
+	uint16_t crc = tlm->crc;
+
+	Tlm_PutLe(tlm, crc, 2);
+	if (tlm->overflow || (tlm->pos >= tlm->size)) {
+		tlm->overflow = 1;
+		return 0;
+	}
+	tlm->buf[tlm->codePos] = tlm->code;
+	tlm->buf[tlm->pos++] = 0x00;
+
+	return tlm->pos;
+}
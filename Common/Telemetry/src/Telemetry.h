@@ -0,0 +1,113 @@
+/*
+ * Telemetry.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_TELEMETRY_H_
+#define INC_TELEMETRY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+
+/* Define ------------------------------------------------------------*/
+
+/*
+ *  ---------------------- Telemetry record (before COBS) ---------------------
+ *  | TYPE:1 | SEQ:2 | TIME ms:4 | FIELD ... FIELD | CRC16:2 |
+ *  FIELD = | KIND[7:5] ID[4:0] | value (little endian) |
+ *  ---------------------------------------------------------------------------
+ *  CRC16 is CCITT (0x1021, init 0xFFFF) over everything before it. The
+ *  record is COBS encoded with a 0x00 delimiter on both sides, so text
+ *  printed on the same UART ends up in a frame of its own and fails the
+ *  CRC instead of corrupting the next record. Field IDs are per TYPE.
+ *  Tools/telemetry.py is the host decoder.
+ */
+#define TLM_KIND_U8 					0U
+#define TLM_KIND_U16 					1U
+#define TLM_KIND_U32 					2U
+#define TLM_KIND_I16 					3U
+#define TLM_KIND_I32 					4U
+#define TLM_KIND_F32 					5U
+#define TLM_KIND_BYTES 					6U		/* length byte + data		*/
+
+#define TLM_HEADER_LEN 					7U
+#define TLM_CRC_LEN 					2U
+
+/* Output bytes for n record bytes: COBS codes plus both delimiters */
+#define TLM_ENCODED_MAX(n) 				((n) + ((n) / 254U) + 3U)
+
+/* Record types and their fields */
+#define TLM_REC_POWER 					0x01U	/* HLW8012 reading			*/
+#define TLM_F_VOLTAGE 					0U		/* U16 V					*/
+#define TLM_F_CURRENT 					1U		/* U16 mA					*/
+#define TLM_F_POWER 					2U		/* U16 W					*/
+#define TLM_F_ENERGY 					3U		/* U32 Ws					*/
+
+#define TLM_REC_POWER_SERIES 			0x02U	/* HLW8012 readings, batched	*/
+#define TLM_F_SERIES 					0U		/* BYTES, TsCodec frame		*/
+
+#define TLM_REC_RF_STATUS 				0x10U	/* RF433 receiver health	*/
+#define TLM_F_RF_ISR_AVG 				0U		/* U16 cycles				*/
+#define TLM_F_RF_ISR_MAX 				1U		/* U16 cycles				*/
+#define TLM_F_RF_LOG_DROPPED 			2U		/* U32 bytes				*/
+#define TLM_F_RF_TRACE_DROPPED 			3U		/* U32 records				*/
+#define TLM_F_RF_POOL_HIGH 				4U		/* BYTES, blocks per class	*/
+#define TLM_F_RF_POOL_FAILS 			5U		/* U32 empty-class requests	*/
+#define TLM_F_RF_STACK_PEAK 			6U		/* U16 bytes				*/
+#define TLM_F_RF_HEAP_USED 				7U		/* U16 bytes				*/
+#define TLM_F_RF_FLOG_BLOCKS 			8U		/* U32 flash log blocks		*/
+#define TLM_F_RF_FLOG_DROPPED 			9U		/* U32 samples				*/
+#define TLM_F_RF_FLOG_ERRORS 			10U		/* U32 failed flash ops		*/
+#define TLM_F_RF_FLOG_RECOVER_US 		11U		/* U32 boot scan time		*/
+#define TLM_F_RF_WDG_RESETS 			12U		/* U32 supervised resets	*/
+#define TLM_F_RF_WDG_REASON 			13U		/* U8 last reset reason		*/
+#define TLM_F_RF_WDG_TASK 				14U		/* U8 last late task		*/
+#define TLM_F_RF_WDG_TOTAL 				15U		/* U32 resets kept in EEPROM	*/
+
+#define TLM_REC_RF_RX 					0x11U	/* RF433 message			*/
+#define TLM_F_RF_PAYLOAD 				0U		/* BYTES					*/
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief Encoder state; the record is COBS encoded as it is written,
+ * 		  straight into the caller's output buffer.
+ */
+typedef struct {
+	uint8_t 	*buf;
+	uint16_t 	size;
+	uint16_t 	pos;					/* next output byte					*/
+	uint16_t 	codePos;				/* COBS code byte of the open block	*/
+	uint16_t 	crc;
+	uint8_t 	code;					/* open block length + 1			*/
+	uint8_t 	overflow;
+
+}Handle_Tlm_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void Tlm_Begin(Handle_Tlm_S *tlm, uint8_t *buf, uint16_t size, uint8_t type, uint16_t seq, uint32_t timeMs);
+void Tlm_PutU8(Handle_Tlm_S *tlm, uint8_t id, uint8_t value);
+void Tlm_PutU16(Handle_Tlm_S *tlm, uint8_t id, uint16_t value);
+void Tlm_PutU32(Handle_Tlm_S *tlm, uint8_t id, uint32_t value);
+void Tlm_PutI16(Handle_Tlm_S *tlm, uint8_t id, int16_t value);
+void Tlm_PutI32(Handle_Tlm_S *tlm, uint8_t id, int32_t value);
+void Tlm_PutF32(Handle_Tlm_S *tlm, uint8_t id, float value);
+void Tlm_PutBytes(Handle_Tlm_S *tlm, uint8_t id, const uint8_t *data, uint8_t len);
+uint16_t Tlm_End(Handle_Tlm_S *tlm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_TELEMETRY_H_ */
@@ -0,0 +1,342 @@
+/*
+ * TsCodec.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Streaming compression of slowly varying time series, in the manner
+ *  of Gorilla: delta-of-delta timestamps and small zig-zag numbers in a
+ *  bit stream, so a reading that did not change costs one bit. Values
+ *  are integers (mV, mA, W, Ws); a change is a delta, or a delta of the
+ *  delta for counters like energy. All state is in the handle and the
+ *  frame is written straight into the caller's buffer, no heap. Plain C
+ *  with 32-bit constants marked UL, as int is 16 bits on the RL78; the
+ *  same file builds for the STM32 apps, the ESP8285 sketch, the RL78
+ *  LCD_TEST project and the host benchmark (Tools/tsc_bench.c). Bit
+ *  positions are 16 bits wide, cheap on the RL78, so a frame is at most
+ *  TSC_FRAME_MAX bytes; a larger buffer or length is clamped to it.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "TsCodec.h"
+
+/* Function prototypes -------------------------------------------------------*/
+
+static uint32_t Tsc_ZigZag(uint32_t d)
+{
+	return (d << 1) ^ (0UL - (d >> 31));
+}
+
+static uint32_t Tsc_UnZigZag(uint32_t z)
+{
+	return (z >> 1) ^ (0UL - (z & 1UL));
+}
+
+/*
+ * @brief : Bits a zig-zag number takes, prefix included
+ * @param : z - number
+ * @retval : uint8_t - bits
+ */
+static uint8_t Tsc_Cost(uint32_t z)
+{
+	if (z == 0UL) {
+		return 1U;
+	}
+	if (z < 0x10UL) {
+		return 2U + 4U;
+	}
+	if (z < 0x100UL) {
+		return 3U + 8U;
+	}
+	if (z < 0x10000UL) {
+		return 4U + 16U;
+	}
+	return 4U + 32U;
+}
+
+/*
+ * @brief : Append bits, MSB first. The caller has checked the room.
+ * @param : tsc - encoder
+ * 			v   - bits, right aligned
+ * 			n   - count, 1..32
+ * @retval : none
+ */
+static void Tsc_WriteBits(Handle_Tsc_S *tsc, uint32_t v, uint8_t n)
+{
+	uint8_t used, take;
+	uint8_t *p;
+
+	while (n != 0U) {
+		used = (uint8_t)(tsc->bits & 7U);
+		take = (uint8_t)(8U - used);
+		if (take > n) {
+			take = n;
+		}
+		p = &tsc->buf[tsc->bits >> 3];
+		if (used == 0U) {
+			*p = 0;
+		}
+		*p |= (uint8_t)(((v >> (n - take)) & ((1UL << take) - 1UL)) << (8U - used - take));
+		tsc->bits += take;
+		n -= take;
+	}
+}
+
+/*
+ * @brief : Append a zig-zag number with its width prefix
+ * @param : tsc - encoder
+ * 			z   - number
+ * @retval : none
+ */
+static void Tsc_WriteNum(Handle_Tsc_S *tsc, uint32_t z)
+{
+	if (z == 0UL) {
+		Tsc_WriteBits(tsc, 0x0UL, 1U);
+	}
+	else if (z < 0x10UL) {
+		Tsc_WriteBits(tsc, 0x2UL, 2U);
+		Tsc_WriteBits(tsc, z, 4U);
+	}
+	else if (z < 0x100UL) {
+		Tsc_WriteBits(tsc, 0x6UL, 3U);
+		Tsc_WriteBits(tsc, z, 8U);
+	}
+	else if (z < 0x10000UL) {
+		Tsc_WriteBits(tsc, 0xEUL, 4U);
+		Tsc_WriteBits(tsc, z, 16U);
+	}
+	else {
+		Tsc_WriteBits(tsc, 0xFUL, 4U);
+		Tsc_WriteBits(tsc, z, 32U);
+	}
+}
+
+/*
+ * @brief : Start a frame in buf.
+ * @param : tsc      - encoder
+ * 			buf      - output, at least TSC_HEADER_LEN + TSC_RAW_LEN(channels)
+ * 			size     - buf size, only TSC_FRAME_MAX bytes of it are used
+ * 			channels - values per sample, 1..TSC_CHANNELS_MAX
+ * 			dodMask  - bit c: channel c is a counter, code delta-of-delta
+ * @retval : none
+ */
+void Tsc_Begin(Handle_Tsc_S *tsc, uint8_t *buf, uint16_t size, uint8_t channels, uint8_t dodMask)
+{
+	if (channels > TSC_CHANNELS_MAX) {
+		channels = TSC_CHANNELS_MAX;
+	}
+	if (size > TSC_FRAME_MAX) {
+		size = TSC_FRAME_MAX;
+	}
+
+	tsc->buf      = buf;
+	tsc->size     = size;
+	tsc->bits     = TSC_HEADER_LEN * 8U;
+	tsc->count    = 0;
+	tsc->channels = channels;
+	tsc->dodMask  = (uint8_t)(dodMask & ((1U << channels) - 1U));
+}
+
+/*
+ * @brief : Add a sample if it fits; nothing is written when it does not.
+ * @param : tsc    - encoder
+ * 			time   - sample time, any unit, wraps
+ * 			values - one per channel
+ * @retval : 1 when added, 0 when the frame is full: Tsc_End() it and
+ * 			put the sample into a new frame
+ */
+uint8_t Tsc_Put(Handle_Tsc_S *tsc, uint32_t time, const int32_t *values)
+{
+	uint32_t z[TSC_CHANNELS_MAX], d[TSC_CHANNELS_MAX];
+	uint32_t zt, dt, need;
+	uint8_t c;
+
+	if (tsc->count == TSC_SAMPLES_MAX) {
+		return 0;
+	}
+
+	if (tsc->count == 0U) {
+		need = (uint32_t)(32UL * (1UL + tsc->channels));
+		if (((uint32_t)tsc->bits + need) > ((uint32_t)tsc->size * 8UL)) {
+			return 0;
+		}
+		Tsc_WriteBits(tsc, time, 32U);
+		for (c = 0; c < tsc->channels; c++) {
+			Tsc_WriteBits(tsc, (uint32_t)values[c], 32U);
+			tsc->value[c] = (uint32_t)values[c];
+			tsc->delta[c] = 0;
+		}
+		tsc->time      = time;
+		tsc->timeDelta = 0;
+		tsc->count     = 1;
+		return 1;
+	}
+
+	/* Size the sample first, so a full frame is left as it is */
+	dt   = time - tsc->time;
+	zt   = Tsc_ZigZag(dt - tsc->timeDelta);
+	need = Tsc_Cost(zt);
+	for (c = 0; c < tsc->channels; c++) {
+		d[c] = (uint32_t)values[c] - tsc->value[c];
+		z[c] = Tsc_ZigZag((tsc->dodMask & (1U << c)) ? (d[c] - tsc->delta[c]) : d[c]);
+		need += Tsc_Cost(z[c]);
+	}
+	if (((uint32_t)tsc->bits + need) > ((uint32_t)tsc->size * 8UL)) {
+		return 0;
+	}
+
+	Tsc_WriteNum(tsc, zt);
+	for (c = 0; c < tsc->channels; c++) {
+		Tsc_WriteNum(tsc, z[c]);
+		tsc->value[c] = (uint32_t)values[c];
+		tsc->delta[c] = d[c];
+	}
+	tsc->time      = time;
+	tsc->timeDelta = dt;
+	tsc->count++;
+	return 1;
+}
+
+/*
+ * @brief : Close the frame: header in, last byte padded.
+ * @param : tsc - encoder
+ * @retval : uint16_t - frame length in bytes, 0 when it holds no sample
+ */
+uint16_t Tsc_End(Handle_Tsc_S *tsc)
+{
+	if (tsc->count == 0U) {
+		return 0;
+	}
+
+	tsc->buf[0] = tsc->count;
+	tsc->buf[1] = (uint8_t)(tsc->channels | (tsc->dodMask << 4));
+	return (uint16_t)((tsc->bits + 7U) >> 3);
+}
+
+/*
+ * @brief : Read bits, MSB first; past the end of the frame reads 0
+ * 			and sets overrun.
+ * @param : dec - decoder
+ * 			n   - count, 1..32
+ * @retval : uint32_t - bits, right aligned
+ */
+static uint32_t Tsc_ReadBits(Handle_TscDec_S *dec, uint8_t n)
+{
+	uint32_t v = 0;
+	uint8_t used, take;
+
+	if (((uint32_t)dec->bits + n) > ((uint32_t)dec->len * 8UL)) {
+		dec->overrun = 1;
+		return 0;
+	}
+
+	while (n != 0U) {
+		used = (uint8_t)(dec->bits & 7U);
+		take = (uint8_t)(8U - used);
+		if (take > n) {
+			take = n;
+		}
+		v = (v << take) | (uint32_t)((dec->buf[dec->bits >> 3] >> (8U - used - take)) & ((1UL << take) - 1UL));
+		dec->bits += take;
+		n -= take;
+	}
+	return v;
+}
+
+/*
+ * @brief : Read a zig-zag number and map it back
+ * @param : dec - decoder
+ * @retval : uint32_t - signed value, two's complement
+ */
+static uint32_t Tsc_ReadNum(Handle_TscDec_S *dec)
+{
+	if (Tsc_ReadBits(dec, 1U) == 0UL) {
+		return 0;
+	}
+	if (Tsc_ReadBits(dec, 1U) == 0UL) {
+		return Tsc_UnZigZag(Tsc_ReadBits(dec, 4U));
+	}
+	if (Tsc_ReadBits(dec, 1U) == 0UL) {
+		return Tsc_UnZigZag(Tsc_ReadBits(dec, 8U));
+	}
+	if (Tsc_ReadBits(dec, 1U) == 0UL) {
+		return Tsc_UnZigZag(Tsc_ReadBits(dec, 16U));
+	}
+	return Tsc_UnZigZag(Tsc_ReadBits(dec, 32U));
+}
+
+/*
+ * @brief : Start reading a frame
+ * @param : dec - decoder
+ * 			buf - frame
+ * 			len - frame length, TSC_FRAME_MAX at most is read
+ * @retval : uint8_t - samples in the frame, 0 if the header is bad
+ */
+uint8_t Tsc_DecodeBegin(Handle_TscDec_S *dec, const uint8_t *buf, uint16_t len)
+{
+	if (len > TSC_FRAME_MAX) {
+		len = TSC_FRAME_MAX;
+	}
+
+	dec->buf     = buf;
+	dec->len     = len;
+	dec->bits    = TSC_HEADER_LEN * 8U;
+	dec->index   = 0;
+	dec->overrun = 0;
+	dec->left    = 0;
+
+	if ((len < TSC_HEADER_LEN) || ((buf[1] & 0x0FU) == 0U) || ((buf[1] & 0x0FU) > TSC_CHANNELS_MAX)) {
+		return 0;
+	}
+	dec->channels = buf[1] & 0x0FU;
+	dec->dodMask  = buf[1] >> 4;
+	dec->left     = buf[0];
+	return dec->left;
+}
+
+/*
+ * @brief : Next sample of the frame
+ * @param : dec    - decoder
+ * 			time   - sample time
+ * 			values - one per channel
+ * @retval : 1 with a sample, 0 at the end or on a short frame
+ */
+uint8_t Tsc_DecodeNext(Handle_TscDec_S *dec, uint32_t *time, int32_t *values)
+{
+	uint32_t x;
+	uint8_t c;
+
+	if ((dec->left == 0U) || dec->overrun) {
+		return 0;
+	}
+
+	if (dec->index == 0U) {
+		dec->time      = Tsc_ReadBits(dec, 32U);
+		dec->timeDelta = 0;
+		for (c = 0; c < dec->channels; c++) {
+			dec->value[c] = Tsc_ReadBits(dec, 32U);
+			dec->delta[c] = 0;
+		}
+	}
+	else {
+		dec->timeDelta += Tsc_ReadNum(dec);
+		dec->time      += dec->timeDelta;
+		for (c = 0; c < dec->channels; c++) {
+			x = Tsc_ReadNum(dec);
+			dec->delta[c]  = (dec->dodMask & (1U << c)) ? (dec->delta[c] + x) : x;
+			dec->value[c] += dec->delta[c];
+		}
+	}
+
+	if (dec->overrun) {
+		return 0;
+	}
+
+	*time = dec->time;
+	for (c = 0; c < dec->channels; c++) {
+		values[c] = (int32_t)dec->value[c];
+	}
+	dec->index++;
+	dec->left--;
+	return 1;
+}
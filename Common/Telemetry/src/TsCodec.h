@@ -0,0 +1,107 @@
+/*
+ * TsCodec.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_TSCODEC_H_
+#define INC_TSCODEC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+
+/* Define ------------------------------------------------------------*/
+#define TSC_CHANNELS_MAX 				4U
+#define TSC_SAMPLES_MAX 				255U
+#define TSC_HEADER_LEN 					2U
+/* Largest frame: its bit count still fits the 16-bit bit positions */
+#define TSC_FRAME_MAX 					8191U
+
+/* Raw size of one sample: 32-bit time and 32 bits per channel */
+#define TSC_RAW_LEN(ch) 				(4U + (4U * (ch)))
+
+/* Build with TSC_BENCH=1 to time the encoder at boot (RF433 receiver main.c,
+ * LCD_TEST r_main.c) */
+#ifndef TSC_BENCH
+#define TSC_BENCH 						0
+#endif
+
+/*
+ *  ------------------------ Series frame (bit stream) ------------------------
+ *  | COUNT:8 | CHANNELS[3:0] DOD MASK[7:4] | first sample, raw | samples ... |
+ *  first sample : time:32, then value:32 per channel
+ *  next samples : time as delta-of-delta, then per channel the delta, or
+ *                 the delta-of-delta when its DOD MASK bit is set
+ *  Every number is zig-zag mapped (0, -1, 1, -2 ... -> 0, 1, 2, 3 ...)
+ *  and written with a prefix that gives its width, MSB first:
+ *      0                 zero
+ *      10   + 4 bits     < 16
+ *      110  + 8 bits     < 256
+ *      1110 + 16 bits    < 65536
+ *      1111 + 32 bits
+ *  The last byte is padded with 0 bits; COUNT tells where to stop.
+ *  A frame decodes on its own, so a lost frame loses only its samples.
+ *  Tools/tsc.py is the host decoder.
+ *  ---------------------------------------------------------------------------
+ */
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief Encoder, fixed size; the frame is built in the caller's buffer
+ */
+typedef struct {
+	uint8_t 	*buf;
+	uint16_t 	size;					/* bytes							*/
+	uint16_t 	bits;					/* written							*/
+	uint8_t 	count;
+	uint8_t 	channels;
+	uint8_t 	dodMask;
+	uint32_t 	time;					/* previous sample					*/
+	uint32_t 	timeDelta;
+	uint32_t 	value[TSC_CHANNELS_MAX];
+	uint32_t 	delta[TSC_CHANNELS_MAX];
+
+}Handle_Tsc_S;
+
+/*
+ * @brief Decoder, same state plus a read position
+ */
+typedef struct {
+	const uint8_t 	*buf;
+	uint16_t 		len;
+	uint16_t 		bits;				/* read								*/
+	uint8_t 		left;				/* samples still in the frame		*/
+	uint8_t 		index;
+	uint8_t 		channels;
+	uint8_t 		dodMask;
+	uint8_t 		overrun;			/* frame shorter than COUNT says	*/
+	uint32_t 		time;
+	uint32_t 		timeDelta;
+	uint32_t 		value[TSC_CHANNELS_MAX];
+	uint32_t 		delta[TSC_CHANNELS_MAX];
+
+}Handle_TscDec_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void Tsc_Begin(Handle_Tsc_S *tsc, uint8_t *buf, uint16_t size, uint8_t channels, uint8_t dodMask);
+uint8_t Tsc_Put(Handle_Tsc_S *tsc, uint32_t time, const int32_t *values);
+uint16_t Tsc_End(Handle_Tsc_S *tsc);
+uint8_t Tsc_DecodeBegin(Handle_TscDec_S *dec, const uint8_t *buf, uint16_t len);
+uint8_t Tsc_DecodeNext(Handle_TscDec_S *dec, uint32_t *time, int32_t *values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_TSCODEC_H_ */
@@ -1,140 +1,214 @@
-#include <Arduino.h>
-#include "HLW8012.h"
-#include "string.h"
-
-
-#define SERIAL_BAUDRATE                 115200
-
-#define BLUE_LED                       13
-
-char aBuf[100]          = {0};
-uint32_t Voltage        = 0;
-double Current          = 0.0;
-uint32_t Active_Power   = 0;
-uint32_t Energy         = 0;
-
-// GPIOs
-#define RELAY_PIN                       14
-#define SEL_PIN                         12
-#define CF1_PIN                         5
-#define CF_PIN                          4
-
-// Check values every 10 seconds
-#define UPDATE_TIME                     5000
-
-// Set SEL_PIN to HIGH to sample current
-// This is the case for Itead's Sonoff POW, where a
-// the SEL_PIN drives a transistor that pulls down
-// the SEL pin in the HLW8012 when closed
-#define CURRENT_MODE                    LOW //HIGH
-
-// These are the nominal values for the resistors in the circuit
-#define CURRENT_RESISTOR                0.001
-#define VOLTAGE_RESISTOR_UPSTREAM       ( 2 * 1000000 ) // Real: 2Mohm
-#define VOLTAGE_RESISTOR_DOWNSTREAM     ( 1000 ) // Real 1.009k
-
-HLW8012           hlw8012;
-
-
-// When using interrupts we have to call the library entry point
-// whenever an interrupt is triggered
-void ICACHE_RAM_ATTR hlw8012_cf1_interrupt() {
-    hlw8012.cf1_interrupt();
-}
-void ICACHE_RAM_ATTR hlw8012_cf_interrupt() {
-    hlw8012.cf_interrupt();
-}
-
-// Library expects an interrupt on both edges
-void setInterrupts() {
-    attachInterrupt(digitalPinToInterrupt(CF1_PIN), hlw8012_cf1_interrupt, CHANGE);
-    attachInterrupt(digitalPinToInterrupt(CF_PIN), hlw8012_cf_interrupt, CHANGE);
-}
-
-void calibrate() {
-
-    // Let some time to register values
-    unsigned long timeout = millis();
-    while ((millis() - timeout) < 5000) {
-        delay(1);
-    }
-
-    // Calibrate using a 60W bulb (pure resistive) on a 230V line
-    hlw8012.expectedActivePower(60.0);
-    hlw8012.expectedVoltage(230.0);
-    hlw8012.expectedCurrent(60.0 / 230.0);
-
-    // Show corrected factors
-    Serial.print("[HLW] New current multiplier : "); Serial.println(hlw8012.getCurrentMultiplier());
-    Serial.print("[HLW] New voltage multiplier : "); Serial.println(hlw8012.getVoltageMultiplier());
-    Serial.print("[HLW] New power multiplier   : "); Serial.println(hlw8012.getPowerMultiplier());
-
-}
-
-void setup() {
-
-    // Init serial port and clean garbage
-    Serial.begin(SERIAL_BAUDRATE);
-    Serial.println();
-    Serial.println();
-
-    // Close the relay to switch on the load
-    pinMode(RELAY_PIN, OUTPUT);
-    pinMode(BLUE_LED, OUTPUT);
-
-    for(uint8_t i=0; i<5; i++) {
-      digitalWrite(BLUE_LED, HIGH);
-      delay(500);
-      digitalWrite(BLUE_LED, LOW);
-      delay(500);
-    }
-    
-    digitalWrite(RELAY_PIN, HIGH);
-    
-    // Initialize HLW8012
-    // void begin(unsigned char cf_pin, unsigned char cf1_pin, unsigned char sel_pin, unsigned char currentWhen = HIGH, bool use_interrupts = false, unsigned long pulse_timeout = PULSE_TIMEOUT);
-    // * cf_pin, cf1_pin and sel_pin are GPIOs to the HLW8012 IC
-    // * currentWhen is the value in sel_pin to select current sampling
-    // * set use_interrupts to true to use interrupts to monitor pulse widths
-    // * leave pulse_timeout to the default value, recommended when using interrupts
-    hlw8012.begin(CF_PIN, CF1_PIN, SEL_PIN, CURRENT_MODE, true);
-
-    // These values are used to calculate current, voltage and power factors as per datasheet formula
-    // These are the nominal values for the Sonoff POW resistors:
-    // * The CURRENT_RESISTOR is the 1milliOhm copper-manganese resistor in series with the main line
-    // * The VOLTAGE_RESISTOR_UPSTREAM are the 5 470kOhm resistors in the voltage divider that feeds the V2P pin in the HLW8012
-    // * The VOLTAGE_RESISTOR_DOWNSTREAM is the 1kOhm resistor in the voltage divider that feeds the V2P pin in the HLW8012
-    hlw8012.setResistors(CURRENT_RESISTOR, VOLTAGE_RESISTOR_UPSTREAM, VOLTAGE_RESISTOR_DOWNSTREAM);
-
-    // Show default (as per datasheet) multipliers
-    Serial.print("[HLW] Default current multiplier : "); Serial.println(hlw8012.getCurrentMultiplier());
-    Serial.print("[HLW] Default voltage multiplier : "); Serial.println(hlw8012.getVoltageMultiplier());
-    Serial.print("[HLW] Default power multiplier   : "); Serial.println(hlw8012.getPowerMultiplier());
-    Serial.println();
-
-    setInterrupts();
-    hlw8012.setVoltageMultiplier((double)36519172.51);
-
-    calibrate();
-
-}
-
-char buffer[50];
-
-void loop() {
-
-    static unsigned long last = millis();
-
-    // This UPDATE_TIME should be at least twice the interrupt timeout (2 second by default)
-    if ((millis() - last) > UPDATE_TIME) {
-
-        last = millis();
-        Active_Power = hlw8012.getActivePower();
-        Voltage  = hlw8012.getVoltage();
-        Current  = hlw8012.getCurrent();
-
-        sprintf(aBuf, "Volt : %u \t Curr : %.3lf \t Power : %u \n", Voltage, Current, Active_Power);
-        Serial.print(aBuf);
-    }
-
-}
+#include <Arduino.h>
+#include "HLW8012.h"
+#include <Telemetry.h>
+#include <TsCodec.h>
+#include "string.h"
+
+
+#define SERIAL_BAUDRATE                 115200
+
+// 1: readings go out as COBS framed records (Tools/telemetry.py)
+// 0: the old text line
+#define TELEMETRY_BINARY                1
+
+// 1: readings are batched into a TsCodec frame (delta coded, Tools/tsc.py)
+//    and sent as one power_series record every TELEMETRY_SERIES_SAMPLES
+//    readings, or earlier when the frame is full. A steady load takes
+//    ~4 bytes a reading instead of 26; the readings arrive late by up to
+//    TELEMETRY_SERIES_SAMPLES * UPDATE_TIME.
+#define TELEMETRY_SERIES                0
+#define TELEMETRY_SERIES_SAMPLES        60
+#define TELEMETRY_SERIES_FRAME          200     // BYTES field, at most 255
+#define TELEMETRY_SERIES_CHANNELS       4       // V, mA, W, Ws
+#define TELEMETRY_SERIES_DOD            0x08    // energy is a counter
+
+#define BLUE_LED                       13
+
+char aBuf[100]          = {0};
+uint32_t Voltage        = 0;
+double Current          = 0.0;
+uint32_t Active_Power   = 0;
+uint32_t Energy         = 0;
+
+uint16_t tlmSeq         = 0;
+uint8_t tlmBuf[TLM_ENCODED_MAX(TLM_HEADER_LEN + 16 + TLM_CRC_LEN)];
+
+#if TELEMETRY_SERIES
+Handle_Tsc_S tsc;
+uint8_t tscBuf[TELEMETRY_SERIES_FRAME];
+uint8_t seriesBuf[TLM_ENCODED_MAX(TLM_HEADER_LEN + 2 + TELEMETRY_SERIES_FRAME + TLM_CRC_LEN)];
+#endif
+
+// GPIOs
+#define RELAY_PIN                       14
+#define SEL_PIN                         12
+#define CF1_PIN                         5
+#define CF_PIN                          4
+
+// Check values every 10 seconds
+#define UPDATE_TIME                     5000
+
+// Set SEL_PIN to HIGH to sample current
+// This is the case for Itead's Sonoff POW, where a
+// the SEL_PIN drives a transistor that pulls down
+// the SEL pin in the HLW8012 when closed
+#define CURRENT_MODE                    LOW //HIGH
+
+// These are the nominal values for the resistors in the circuit
+#define CURRENT_RESISTOR                0.001
+#define VOLTAGE_RESISTOR_UPSTREAM       ( 2 * 1000000 ) // Real: 2Mohm
+#define VOLTAGE_RESISTOR_DOWNSTREAM     ( 1000 ) // Real 1.009k
+
+HLW8012           hlw8012;
+
+
+// When using interrupts we have to call the library entry point
+// whenever an interrupt is triggered
+void ICACHE_RAM_ATTR hlw8012_cf1_interrupt() {
+    hlw8012.cf1_interrupt();
+}
+void ICACHE_RAM_ATTR hlw8012_cf_interrupt() {
+    hlw8012.cf_interrupt();
+}
+
+// Library expects an interrupt on both edges
+void setInterrupts() {
+    attachInterrupt(digitalPinToInterrupt(CF1_PIN), hlw8012_cf1_interrupt, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(CF_PIN), hlw8012_cf_interrupt, CHANGE);
+}
+
+void calibrate() {
+
+    // Let some time to register values
+    unsigned long timeout = millis();
+    while ((millis() - timeout) < 5000) {
+        delay(1);
+    }
+
+    // Calibrate using a 60W bulb (pure resistive) on a 230V line
+    hlw8012.expectedActivePower(60.0);
+    hlw8012.expectedVoltage(230.0);
+    hlw8012.expectedCurrent(60.0 / 230.0);
+
+    // Show corrected factors
+    Serial.print("[HLW] New current multiplier : "); Serial.println(hlw8012.getCurrentMultiplier());
+    Serial.print("[HLW] New voltage multiplier : "); Serial.println(hlw8012.getVoltageMultiplier());
+    Serial.print("[HLW] New power multiplier   : "); Serial.println(hlw8012.getPowerMultiplier());
+
+}
+
+void setup() {
+
+    // Init serial port and clean garbage
+    Serial.begin(SERIAL_BAUDRATE);
+    Serial.println();
+    Serial.println();
+
+    // Close the relay to switch on the load
+    pinMode(RELAY_PIN, OUTPUT);
+    pinMode(BLUE_LED, OUTPUT);
+
+    for(uint8_t i=0; i<5; i++) {
+      digitalWrite(BLUE_LED, HIGH);
+      delay(500);
+      digitalWrite(BLUE_LED, LOW);
+      delay(500);
+    }
+    
+    digitalWrite(RELAY_PIN, HIGH);
+    
+    // Initialize HLW8012
+    // void begin(unsigned char cf_pin, unsigned char cf1_pin, unsigned char sel_pin, unsigned char currentWhen = HIGH, bool use_interrupts = false, unsigned long pulse_timeout = PULSE_TIMEOUT);
+    // * cf_pin, cf1_pin and sel_pin are GPIOs to the HLW8012 IC
+    // * currentWhen is the value in sel_pin to select current sampling
+    // * set use_interrupts to true to use interrupts to monitor pulse widths
+    // * leave pulse_timeout to the default value, recommended when using interrupts
+    hlw8012.begin(CF_PIN, CF1_PIN, SEL_PIN, CURRENT_MODE, true);
+
+    // These values are used to calculate current, voltage and power factors as per datasheet formula
+    // These are the nominal values for the Sonoff POW resistors:
+    // * The CURRENT_RESISTOR is the 1milliOhm copper-manganese resistor in series with the main line
+    // * The VOLTAGE_RESISTOR_UPSTREAM are the 5 470kOhm resistors in the voltage divider that feeds the V2P pin in the HLW8012
+    // * The VOLTAGE_RESISTOR_DOWNSTREAM is the 1kOhm resistor in the voltage divider that feeds the V2P pin in the HLW8012
+    hlw8012.setResistors(CURRENT_RESISTOR, VOLTAGE_RESISTOR_UPSTREAM, VOLTAGE_RESISTOR_DOWNSTREAM);
+
+    // Show default (as per datasheet) multipliers
+    Serial.print("[HLW] Default current multiplier : "); Serial.println(hlw8012.getCurrentMultiplier());
+    Serial.print("[HLW] Default voltage multiplier : "); Serial.println(hlw8012.getVoltageMultiplier());
+    Serial.print("[HLW] Default power multiplier   : "); Serial.println(hlw8012.getPowerMultiplier());
+    Serial.println();
+
+    setInterrupts();
+    hlw8012.setVoltageMultiplier((double)36519172.51);
+
+    calibrate();
+
+#if TELEMETRY_SERIES
+    Tsc_Begin(&tsc, tscBuf, sizeof(tscBuf), TELEMETRY_SERIES_CHANNELS, TELEMETRY_SERIES_DOD);
+#endif
+
+}
+
+#if TELEMETRY_SERIES
+// Send the frame built so far and start the next one
+void sendSeries(unsigned long now) {
+
+    Handle_Tlm_S tlm;
+    uint16_t len = Tsc_End(&tsc);
+
+    if (len) {
+        Tlm_Begin(&tlm, seriesBuf, sizeof(seriesBuf), TLM_REC_POWER_SERIES, tlmSeq++, now);
+        Tlm_PutBytes(&tlm, TLM_F_SERIES, tscBuf, (uint8_t)len);
+        Serial.write(seriesBuf, Tlm_End(&tlm));
+    }
+    Tsc_Begin(&tsc, tscBuf, sizeof(tscBuf), TELEMETRY_SERIES_CHANNELS, TELEMETRY_SERIES_DOD);
+
+}
+#endif
+
+char buffer[50];
+
+void loop() {
+
+    static unsigned long last = millis();
+
+    // This UPDATE_TIME should be at least twice the interrupt timeout (2 second by default)
+    if ((millis() - last) > UPDATE_TIME) {
+
+        last = millis();
+        Active_Power = hlw8012.getActivePower();
+        Voltage  = hlw8012.getVoltage();
+        Current  = hlw8012.getCurrent();
+
+#if TELEMETRY_SERIES
+        int32_t reading[TELEMETRY_SERIES_CHANNELS] = {
+            (int32_t)Voltage,
+            (int32_t)((Current * 1000.0) + 0.5),
+            (int32_t)Active_Power,
+            (int32_t)hlw8012.getEnergy()
+        };
+
+        if (!Tsc_Put(&tsc, last, reading)) {
+            sendSeries(last);
+            Tsc_Put(&tsc, last, reading);
+        }
+        if (tsc.count >= TELEMETRY_SERIES_SAMPLES) {
+            sendSeries(last);
+        }
+#elif TELEMETRY_BINARY
+        // 26 bytes on the wire instead of ~42, no float formatting
+        Handle_Tlm_S tlm;
+
+        Tlm_Begin(&tlm, tlmBuf, sizeof(tlmBuf), TLM_REC_POWER, tlmSeq++, last);
+        Tlm_PutU16(&tlm, TLM_F_VOLTAGE, (uint16_t)Voltage);
+        Tlm_PutU16(&tlm, TLM_F_CURRENT, (uint16_t)((Current * 1000.0) + 0.5));
+        Tlm_PutU16(&tlm, TLM_F_POWER, (uint16_t)Active_Power);
+        Tlm_PutU32(&tlm, TLM_F_ENERGY, hlw8012.getEnergy());
+        Serial.write(tlmBuf, Tlm_End(&tlm));
+#else
+        sprintf(aBuf, "Volt : %u \t Curr : %.3lf \t Power : %u \n", Voltage, Current, Active_Power);
+        Serial.print(aBuf);
+#endif
+    }
+
+}
@@ -1,276 +1,432 @@
-/* USER CODE BEGIN Header */
-/**
-  ******************************************************************************
-  * @file           : main.c
-  * @brief          : Main program body
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
-  * All rights reserved.</center></h2>
-  *
-  * This software component is licensed by ST under BSD 3-Clause license,
-  * the "License"; You may not use this file except in compliance with the
-  * License. You may obtain a copy of the License at:
-  *                        opensource.org/licenses/BSD-3-Clause
-  *
-  ******************************************************************************
-  */
-/* USER CODE END Header */
-
-/* Includes ------------------------------------------------------------------*/
-#include "main.h"
-
-/* Private includes ----------------------------------------------------------*/
-/* USER CODE BEGIN Includes */
-
-/* USER CODE END Includes */
-
-/* Private typedef -----------------------------------------------------------*/
-/* USER CODE BEGIN PTD */
-
-/* USER CODE END PTD */
-
-/* Private define ------------------------------------------------------------*/
-/* USER CODE BEGIN PD */
-
-/* USER CODE END PD */
-
-/* Private macro -------------------------------------------------------------*/
-/* USER CODE BEGIN PM */
-
-/* USER CODE END PM */
-
-/* Private variables ---------------------------------------------------------*/
-UART_HandleTypeDef huart2;
-
-/* USER CODE BEGIN PV */
-
-/* USER CODE END PV */
-
-/* Private function prototypes -----------------------------------------------*/
-void SystemClock_Config(void);
-static void MX_GPIO_Init(void);
-static void MX_USART2_UART_Init(void);
-/* USER CODE BEGIN PFP */
-
-/* USER CODE END PFP */
-
-/* Private user code ---------------------------------------------------------*/
-/* USER CODE BEGIN 0 */
-
-/* USER CODE END 0 */
-
-/**
-  * @brief  The application entry point.
-  * @retval int
-  */
-int main(void)
-{
-  /* USER CODE BEGIN 1 */
-
-  /* USER CODE END 1 */
-
-  /* MCU Configuration--------------------------------------------------------*/
-
-  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
-  HAL_Init();
-
-  /* USER CODE BEGIN Init */
-
-  /* USER CODE END Init */
-
-  /* Configure the system clock */
-  SystemClock_Config();
-
-  /* USER CODE BEGIN SysInit */
-
-  /* USER CODE END SysInit */
-
-  /* Initialize all configured peripherals */
-  MX_GPIO_Init();
-  MX_USART2_UART_Init();
-  /* USER CODE BEGIN 2 */
-  HAL_UART_Transmit(&huart2, (uint8_t *)"User App 1 Started\n", 19, 100);
-
-  HAL_Delay(2000);
-
-  /* USER CODE END 2 */
-
-  /* Infinite loop */
-  /* USER CODE BEGIN WHILE */
-  while (1)
-  {
-    /* USER CODE END WHILE */
-
-    /* USER CODE BEGIN 3 */
-	  	  if(HAL_GPIO_ReadPin(B1_GPIO_Port,B1_Pin) == 0)
-	 	  {
-	  		  HAL_UART_Transmit(&huart2, (uint8_t *)"\nSwitch Pressed\n", 16, 100);
-	  		  HAL_UART_Transmit(&huart2, (uint8_t *)"Jumping to User Application 2\n\n\n", 32, 100);
-		  	  HAL_UART_MspDeInit(&huart2);
-	 	  	  HAL_DeInit();
-
-	 		  uint32_t go_address	= *((volatile uint32_t*) (0x08009000 + 4));
-	 			 		  void (*jump_to_app)(void) = (void *)go_address;
-	 			 		  jump_to_app();
-	 	  }
-	 	  else
-	 	  {
-			  HAL_UART_Transmit(&huart2, (uint8_t *)".", 1, 100);
-	 	  	  HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
-	 	  	  HAL_Delay(500);
-
-	 	  }
-  }
-  /* USER CODE END 3 */
-}
-
-/**
-  * @brief System Clock Configuration
-  * @retval None
-  */
-void SystemClock_Config(void)
-{
-  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
-  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
-  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
-
-  /** Configure the main internal regulator output voltage
-  */
-  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
-  /** Initializes the CPU, AHB and APB busses clocks
-  */
-  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
-  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
-  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
-  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
-  RCC_OscInitStruct.PLL.PLLMUL = RCC_PLLMUL_3;
-  RCC_OscInitStruct.PLL.PLLDIV = RCC_PLLDIV_2;
-  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  /** Initializes the CPU, AHB and APB busses clocks
-  */
-  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
-                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
-  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
-  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
-
-  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_1) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART2;
-  PeriphClkInit.Usart2ClockSelection = RCC_USART2CLKSOURCE_PCLK1;
-  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
-  {
-    Error_Handler();
-  }
-}
-
-/**
-  * @brief USART2 Initialization Function
-  * @param None
-  * @retval None
-  */
-static void MX_USART2_UART_Init(void)
-{
-
-  /* USER CODE BEGIN USART2_Init 0 */
-
-  /* USER CODE END USART2_Init 0 */
-
-  /* USER CODE BEGIN USART2_Init 1 */
-
-  /* USER CODE END USART2_Init 1 */
-  huart2.Instance = USART2;
-  huart2.Init.BaudRate = 115200;
-  huart2.Init.WordLength = UART_WORDLENGTH_8B;
-  huart2.Init.StopBits = UART_STOPBITS_1;
-  huart2.Init.Parity = UART_PARITY_NONE;
-  huart2.Init.Mode = UART_MODE_TX_RX;
-  huart2.Init.HwFlowCtl = UART_HWCONTROL_NONE;
-  huart2.Init.OverSampling = UART_OVERSAMPLING_16;
-  huart2.Init.OneBitSampling = UART_ONE_BIT_SAMPLE_DISABLE;
-  huart2.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
-  if (HAL_UART_Init(&huart2) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  /* USER CODE BEGIN USART2_Init 2 */
-
-  /* USER CODE END USART2_Init 2 */
-
-}
-
-/**
-  * @brief GPIO Initialization Function
-  * @param None
-  * @retval None
-  */
-static void MX_GPIO_Init(void)
-{
-  GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-  /* GPIO Ports Clock Enable */
-  __HAL_RCC_GPIOC_CLK_ENABLE();
-  __HAL_RCC_GPIOH_CLK_ENABLE();
-  __HAL_RCC_GPIOA_CLK_ENABLE();
-
-  /*Configure GPIO pin Output Level */
-  HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, GPIO_PIN_RESET);
-
-  /*Configure GPIO pin : B1_Pin */
-  GPIO_InitStruct.Pin = B1_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
-  GPIO_InitStruct.Pull = GPIO_NOPULL;
-  HAL_GPIO_Init(B1_GPIO_Port, &GPIO_InitStruct);
-
-  /*Configure GPIO pin : LD2_Pin */
-  GPIO_InitStruct.Pin = LD2_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
-  GPIO_InitStruct.Pull = GPIO_NOPULL;
-  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
-  HAL_GPIO_Init(LD2_GPIO_Port, &GPIO_InitStruct);
-
-}
-
-/* USER CODE BEGIN 4 */
-
-/* USER CODE END 4 */
-
-/**
-  * @brief  This function is executed in case of error occurrence.
-  * @retval None
-  */
-void Error_Handler(void)
-{
-  /* USER CODE BEGIN Error_Handler_Debug */
-  /* User can add his own implementation to report the HAL error return state */
-
-  /* USER CODE END Error_Handler_Debug */
-}
-
-#ifdef  USE_FULL_ASSERT
-/**
-  * @brief  Reports the name of the source file and the source line number
-  *         where the assert_param error has occurred.
-  * @param  file: pointer to the source file name
-  * @param  line: assert_param error line source number
-  * @retval None
-  */
-void assert_failed(uint8_t *file, uint32_t line)
-{
-  /* USER CODE BEGIN 6 */
-  /* User can add his own implementation to report the file name and line number,
-     tex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
-  /* USER CODE END 6 */
-}
-#endif /* USE_FULL_ASSERT */
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : main.c
+  * @brief          : Main program body
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* USER CODE BEGIN Includes */
+#include "Boot_Slot.h"
+#include "Boot_Bank.h"
+#include "Boot_Update.h"
+#include "Console.h"
+#include "Boot_Profile.h"
+#include "Boot_Config.h"
+#include "Clock_Profile.h"
+#include "Ram_Usage.h"
+#include "Watchdog.h"
+#include "Fault.h"
+
+/* USER CODE END Includes */
+
+/* Private typedef -----------------------------------------------------------*/
+/* USER CODE BEGIN PTD */
+
+/* USER CODE END PTD */
+
+/* Private define ------------------------------------------------------------*/
+/* USER CODE BEGIN PD */
+
+/* USER CODE END PD */
+
+/* Private macro -------------------------------------------------------------*/
+/* USER CODE BEGIN PM */
+
+/* USER CODE END PM */
+
+/* Private variables ---------------------------------------------------------*/
+UART_HandleTypeDef huart2;
+
+/* USER CODE BEGIN PV */
+static uint8_t appSlot = BOOT_SLOT_APP1;
+static uint8_t appWdgLoop = WDG_TASK_NONE;
+static const Handle_Fault_Record_S *appFault = NULL;
+
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+static void MX_USART2_UART_Init(void);
+/* USER CODE BEGIN PFP */
+
+/* USER CODE END PFP */
+
+/* Private user code ---------------------------------------------------------*/
+/* USER CODE BEGIN 0 */
+
+/*
+ * @brief : Deferred: count this boot in the shared config record.
+ */
+static void App_RecordBoot(void)
+{
+  Boot_ConfigRecordBoot(appSlot);
+}
+
+/*
+ * @brief : Deferred: slot report, then the boot timeline.
+ */
+static void App_BootReport(void)
+{
+  for (uint8_t i = 0; i < BOOT_SLOT_COUNT; i++)
+  {
+	  Console_Printf("Slot %u: status %u, v%08lX, crc %lu us\n",
+			  i + 1, Boot_Report.status[i], Boot_Report.version[i], Boot_Report.verifyUs[i]);
+  }
+  if (Boot_Report.pinned != BOOT_SLOT_NONE)
+  {
+	  Console_Printf("Slot %u pinned by hand\n", Boot_Report.pinned + 1);
+  }
+  const Handle_Boot_Config_S *cfg = Boot_ConfigGet();
+  Console_Printf("Config: seq %lu, boots %lu, reset cause %u, watchdog %lu, last supervised reset %u task %u\n",
+		  cfg->sequence, cfg->bootCount, cfg->resetCause, cfg->watchdogCount, cfg->wdgReason, cfg->wdgTask);
+  if (Wdg_Last.reason != WdgReasonNone)
+  {
+	  Console_Printf("Watchdog: reset for %s, task %s (mask 0x%02X) silent %lu ms, at %lu ms, addr 0x%08lX, %lu since power-on\n",
+			  Wdg_ReasonName(Wdg_Last.reason),
+			  (Wdg_Last.task < Wdg.tasks) ? Wdg.task[Wdg_Last.task].name : "-",
+			  Wdg_Last.lateMask, Wdg_Last.silentMs, Wdg_Last.uptimeMs, Wdg_Last.address, Wdg_Last.count);
+  }
+  Boot_ProfileReport();
+}
+
+/*
+ * @brief : One Fault_Report() line to the console.
+ */
+static void App_FaultLine(const char *line)
+{
+  Console_Printf("%s\n", line);
+}
+
+/*
+ * @brief : Deferred: post-mortem of the HardFault that reset the last run.
+ */
+static void App_FaultReport(void)
+{
+  Fault_Report(appFault, App_FaultLine);
+}
+
+/*
+ * @brief : Deferred: RAM use and the deepest stack seen so far.
+ */
+static void App_RamReport(void)
+{
+  Handle_Ram_Usage_S ram;
+
+  Ram_UsageGet(&ram);
+  Console_Printf("RAM: data %lu, bss %lu, ramfunc %lu, noinit %lu, heap %lu/%lu\n",
+		  ram.dataBytes, ram.bssBytes, ram.ramfuncBytes, ram.noinitBytes, ram.heapUsed, ram.heapArena);
+  Console_Printf("Stack: peak %lu of %lu reserved, %lu never touched\n",
+		  ram.stackPeak, ram.stackReserve, ram.stackHeadroom);
+}
+
+/*
+ * @brief : Deferred: image updates for the other bank arrive on the same UART.
+ */
+static void App_UpdateStart(void)
+{
+  Boot_UpdateInit(&huart2);
+}
+
+/*
+ * @brief : Deferred: the main loop has run for APP_CONFIRM_MS, stop counting
+ * 			this as a failed boot.
+ */
+static void App_ConfirmSlot(void)
+{
+  Boot_ConfirmSlot(appSlot);
+}
+
+/* USER CODE END 0 */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* USER CODE BEGIN 1 */
+  Boot_ProfileMark("main");
+
+  /* USER CODE END 1 */
+
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* USER CODE BEGIN Init */
+  Boot_ProfileMark("HAL_Init");
+
+  /* Why the supervisor reset the last run, if it did */
+  Wdg_Init();
+  appFault = Fault_Init();
+
+  /* USER CODE END Init */
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* USER CODE BEGIN SysInit */
+  Boot_ProfileMark("clock");
+
+  /* Image CRC checks and the config read run at 32 MHz */
+  Clock_ProfileSet(ClockPerformance);
+  Boot_ProfileMark("clock profile");
+
+  /* Watermark for Ram_UsageGet(), at 32 MHz rather than the reset clock */
+  Ram_StackPaint();
+  Boot_ProfileMark("stack paint");
+
+  /* Whichever bank BFB2 boots selects */
+  appSlot = Boot_SlotRunning();
+  Boot_Select(appSlot);
+  Boot_ProfileMark("slot select");
+
+  /* Calibration and counters shared with the other image: one EEPROM read */
+  Boot_ConfigLoad();
+  Boot_ProfileMark("config");
+
+  /* USER CODE END SysInit */
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+  MX_USART2_UART_Init();
+  /* USER CODE BEGIN 2 */
+  Boot_ProfileMark("MX init");
+
+  /* USART2 runs from HSI16: a profile switch never stops it or changes BRR */
+  Clock_ProfileInit(&huart2, NULL, 0);
+
+  /* Console output is queued and sent by the USART2 interrupt */
+  Console_Init(&huart2);
+  Console_Write("User App 1 Started\n", 19);
+
+  /* Nothing that can wait holds up the first loop pass */
+  Boot_Defer(App_RecordBoot, 0);
+  Boot_Defer(App_BootReport, 0);
+  Boot_Defer(App_UpdateStart, 0);
+  Boot_Defer(App_ConfirmSlot, APP_CONFIRM_MS);
+  Boot_Defer(App_RamReport, APP_RAM_REPORT_MS);
+  if (appFault != NULL)
+  {
+	  Boot_Defer(App_FaultReport, APP_FAULT_REPORT_MS);
+  }
+
+  /* IWDG refreshed from SysTick while the loop keeps its deadline */
+  appWdgLoop = Wdg_Register("loop", APP_WDG_LOOP_MS);
+  Wdg_Start();
+
+  Boot_ProfileMark("first loop");
+
+  /* USER CODE END 2 */
+
+  /* Infinite loop */
+  /* USER CODE BEGIN WHILE */
+  while (1)
+  {
+    /* USER CODE END WHILE */
+
+    /* USER CODE BEGIN 3 */
+	  	  Wdg_CheckIn(appWdgLoop);
+	  	  /* Erase, patch and verify steps make an update pass the longest one */
+	  	  Wdg_SetTimeout(appWdgLoop, Boot_UpdateActive() ? APP_WDG_UPDATE_MS : APP_WDG_LOOP_MS);
+
+	  	  Boot_DeferService();
+
+	  	  Boot_UpdateService();
+
+	  	  /* Full speed while an image streams in and is CRC-checked */
+	  	  Clock_ProfileSet(Boot_UpdateActive() ? ClockPerformance : ClockNominal);
+	  	  if (Boot_UpdateActive())
+	  	  {
+	  	  	continue;
+	  	  }
+
+	  	  if(HAL_GPIO_ReadPin(B1_GPIO_Port,B1_Pin) == 0)
+	 	  {
+	  		  Console_Write("\nSwitch Pressed\n", 16);
+	  		  Console_Write("Booting the other bank\n\n\n", 25);
+		  	  Console_Flush();
+		  	  Boot_BankSwitch();
+
+		  	  /* Only reached if the image is not valid */
+		  	  Console_Write("No valid image, staying here\n", 29);
+	 	  }
+	 	  else
+	 	  {
+			  Console_Write(".", 1);
+	 	  	  HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
+	 	  	  HAL_Delay(500);
+
+	 	  }
+  }
+  /* USER CODE END 3 */
+}
+
+/**
+  * @brief System Clock Configuration
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+
+  /** Configure the main internal regulator output voltage
+  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+  /** Initializes the CPU, AHB and APB busses clocks
+  */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLMUL = RCC_PLLMUL_3;
+  RCC_OscInitStruct.PLL.PLLDIV = RCC_PLLDIV_2;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /** Initializes the CPU, AHB and APB busses clocks
+  */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART2;
+  PeriphClkInit.Usart2ClockSelection = RCC_USART2CLKSOURCE_HSI;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief USART2 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_USART2_UART_Init(void)
+{
+
+  /* USER CODE BEGIN USART2_Init 0 */
+
+  /* USER CODE END USART2_Init 0 */
+
+  /* USER CODE BEGIN USART2_Init 1 */
+
+  /* USER CODE END USART2_Init 1 */
+  huart2.Instance = USART2;
+  huart2.Init.BaudRate = 115200;
+  huart2.Init.WordLength = UART_WORDLENGTH_8B;
+  huart2.Init.StopBits = UART_STOPBITS_1;
+  huart2.Init.Parity = UART_PARITY_NONE;
+  huart2.Init.Mode = UART_MODE_TX_RX;
+  huart2.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  huart2.Init.OverSampling = UART_OVERSAMPLING_16;
+  huart2.Init.OneBitSampling = UART_ONE_BIT_SAMPLE_DISABLE;
+  huart2.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN USART2_Init 2 */
+
+  /* USER CODE END USART2_Init 2 */
+
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_GPIO_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+  /*Configure GPIO pin Output Level */
+  HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, GPIO_PIN_RESET);
+
+  /*Configure GPIO pin : B1_Pin */
+  GPIO_InitStruct.Pin = B1_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(B1_GPIO_Port, &GPIO_InitStruct);
+
+  /*Configure GPIO pin : LD2_Pin */
+  GPIO_InitStruct.Pin = LD2_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(LD2_GPIO_Port, &GPIO_InitStruct);
+
+}
+
+/* USER CODE BEGIN 4 */
+
+/* USER CODE END 4 */
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  Wdg_Reset(WdgReasonError, (uint32_t)__builtin_return_address(0));
+
+  /* USER CODE END Error_Handler_Debug */
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+     tex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+}
+#endif /* USE_FULL_ASSERT */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
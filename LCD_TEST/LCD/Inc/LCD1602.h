@@ -1,40 +1,70 @@
-/*
- * lcd1602.h
- *
- *  Created on: 17-Feb-2023
- *      Author: Yoganathan V
- */
-
-/* Define to prevent recursive inclusion -----------------------------*/
-#ifndef INC_LCD1602_H_
-#define INC_LCD1602_H_
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Includes ----------------------------------------------------------*/
-
-/* Define ------------------------------------------------------------*/
-
-/* Macro -------------------------------------------------------------*/
-
-/* Typedef -----------------------------------------------------------*/
-
-/* Variables ---------------------------------------------------------*/
-
-/* Function prototypes -----------------------------------------------*/
-void lcd_init (void);
-void lcd_send_cmd (char cmd);
-void lcd_send_data (char data);
-void lcd_send_string (char *str);
-void lcd_put_cur(int row, int col);
-void lcd_clear (void);
-
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* INC_LCD1602_H_ */
+/*
+ * lcd1602.h
+ *
+ *  Created on: 17-Feb-2023
+ *      Author: Yoganathan V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+#ifndef INC_LCD1602_H_
+#define INC_LCD1602_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include <stdarg.h>
+
+/* Define ------------------------------------------------------------*/
+#define LCD_ROWS                2
+#define LCD_COLS                16
+
+/* CGRAM holds 8 user glyphs of 5x8 pixels, shown as character codes 0..7 */
+#define LCD_CGRAM_SLOTS         8
+#define LCD_GLYPH_ROWS          8
+
+/* Fixed CGRAM slot plan so the bar graph and big digits can share a screen */
+#define LCD_SLOT_BAR            0       /* slots 0..3 : 1..4 column bar cells  */
+#define LCD_SLOT_BIG            4       /* slots 4..6 : big digit segments     */
+#define LCD_SLOT_USER           7       /* slot  7    : free for the app       */
+
+#define LCD_CHAR_BLANK          ' '
+#define LCD_CHAR_FULL           0xFF    /* ROM full block on A00/A02 character sets */
+
+#define LCD_BIG_DIGIT_WIDTH     3
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/* Character sink for the field formatter, lcd_send_data() is one */
+typedef void (*lcd_putc_t)(char c);
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void lcd_init (void);
+void lcd_send_cmd (char cmd);
+void lcd_send_data (char data);
+void lcd_send_string (char *str);
+void lcd_put_cur(int row, int col);
+void lcd_clear (void);
+
+void lcd_glyph_invalidate (void);
+void lcd_glyph_load (uint8_t slot, const uint8_t *glyph);
+void lcd_bar_graph (int row, int col, int width, uint16_t value, uint16_t max);
+void lcd_big_digit (int col, uint8_t digit);
+void lcd_big_number (int col, uint16_t value, int digits);
+
+int lcd_printf (int row, int col, const char *fmt, ...);
+int lcd_format (lcd_putc_t out, const char *fmt, ...);
+int lcd_vformat (lcd_putc_t out, const char *fmt, va_list ap);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_LCD1602_H_ */
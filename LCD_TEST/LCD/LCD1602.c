@@ -1,179 +1,677 @@
-/*
- * LCD1602.c
- *
- *  Created on: 17-Feb-2023
- *      Author: Yoganathan V
- */
-
-/* Includes ------------------------------------------------------------------*/
-#include "LCD1602.h"
-#include "stdint.h"
-#include "r_cg_userdefine.h"
-#include "iodefine.h"
-
-/* Typedef -------------------------------------------------------------------*/
-
-/* Define --------------------------------------------------------------------*/
-
-/* Macro ---------------------------------------------------------------------*/
-
-/* Variables -----------------------------------------------------------------*/
-
-/* Function prototypes -------------------------------------------------------*/
-
-/**
-  * @brief send_to_lcd Function will Send data to LCD(parallel).
-  * @param  data sending data
-  * @param  rs register select output
-  * @retval none
-  */
-void send_to_lcd (char data, int rs)
-{
-    REG_SELECT	= (rs & 0x01);
-
-    /* write the data to the respective pin */
-    DATA_PIN7	= ((data>>3) & 0x01);
-    DATA_PIN6	= ((data>>2) & 0x01);
-    DATA_PIN5	= ((data>>1) & 0x01);
-    DATA_PIN4	= ((data>>0) & 0x01);
-
-    /* Toggle EN PIN to send the data
-    * if the HCLK > 100 MHz, use the  20 us delay
-    * if the LCD still doesn't work, increase the delay to 50, 80 or 100..
-    */
-    ENABLE	= 1;
-    Delay_Us(100);
-
-    ENABLE	= 0;
-    Delay_Us(100);
-
-}
-
-/**
-  * @brief lcd_send_cmd Function will Send Command.
-  * @param  cmd Display command
-  * @retval none
-  */
-void lcd_send_cmd (char cmd)
-{
-    char datatosend;
-
-    /* send upper nibble first
-    RS Must be LOW while sending Command */
-    datatosend = ((cmd>>4)&0x0f);
-    send_to_lcd(datatosend,0);
-
-    /* send Lower Nibble 
-    RS Must be LOW while sending Command */
-    datatosend = ((cmd)&0x0f);
-    send_to_lcd(datatosend, 0);
-}
-
-/**
-  * @brief lcd_send_data Function will Send Data.
-  * @param  data Display Data
-  * @retval none
-  */
-void lcd_send_data (char data)
-{
-    char datatosend;
-
-    /* send higher nibble
-    RS Must be HIGH while sending Data */
-    datatosend = ((data>>4)&0x0f);
-    send_to_lcd(datatosend, 1);
-
-    /* send Lower nibble
-    RS Must be HIGH while sending Data */
-    datatosend = ((data)&0x0f);
-    send_to_lcd(datatosend, 1);
-}
-
-/**
-  * @brief lcd_clear Function will Clear Display.
-  * @param  none
-  * @retval none
-  */
-void lcd_clear (void)
-{
-    lcd_send_cmd(0x01);
-    Delay_Ms(2);
-}
-
-/**
-  * @brief lcd_put_cur Function will Set the Curser on 16x2 Display.
-  * @param  row - Row number
-  * @param  col - column number
-  * @retval none
-  */
-void lcd_put_cur(int row, int col)
-{
-    switch (row)
-    {
-        case 0:
-            col |= 0x80;
-            break;
-        case 1:
-            col |= 0xC0;
-            break;
-    }
-
-    lcd_send_cmd (col);
-}
-
-
-/**
-  * @brief lcd_init Function will initialize the LCD.
-  * @param  none
-  * @retval none
-  */
-void lcd_init (void)
-{
-    READ_DATA = 0;
-
-    /* 4 bit initialisation */
-    Delay_Ms(50);  /* wait for >40ms */
-    lcd_send_cmd (0x30);
-    Delay_Ms(5);  /* wait for >4.1ms */
-    lcd_send_cmd (0x30);
-    Delay_Ms(1);  /* wait for >100us */
-    lcd_send_cmd (0x30);
-    Delay_Ms(10);
-
-    /* 4bit mode */
-    lcd_send_cmd (0x20);
-    Delay_Ms(10);
-
-    /* dislay initialisation  */
-    /* Function set --> DL=0 (4 bit mode), N = 1 (2 line display) F = 0 (5x8 characters) */
-    lcd_send_cmd (0x28);
-    Delay_Ms(1);
-
-    /* Display on/off control --> D=0,C=0, B=0  ---> display off */
-    lcd_send_cmd (0x08);
-    Delay_Ms(1);
-
-    /* clear display */
-    lcd_send_cmd (0x01);
-    Delay_Ms(1);
-    Delay_Ms(1);
-
-    lcd_send_cmd (0x06);
-    Delay_Ms(1);
-
-    /* Display on/off control --> D = 1, C and B = 0. (Cursor and blink, last two bits) */
-    lcd_send_cmd (0x0C);
-}
-
-/**
-  * @brief lcd_send_string Function will Send String data.
-  * @param  str display data
-  * @retval none
-  */
-void lcd_send_string (char *str)
-{
-    while (*str) lcd_send_data (*str++);
-}
-
-
+/*
+ * LCD1602.c
+ *
+ *  Created on: 17-Feb-2023
+ *      Author: Yoganathan V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "LCD1602.h"
+#include "stdint.h"
+#include "stddef.h"
+#include "r_cg_userdefine.h"
+#include "iodefine.h"
+
+/* Typedef -------------------------------------------------------------------*/
+
+/* Define --------------------------------------------------------------------*/
+
+/* Macro ---------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+
+/* Copy of the glyph rows resident in each CGRAM slot, valid where the bit is set */
+static uint8_t cgramRows[LCD_CGRAM_SLOTS][LCD_GLYPH_ROWS];
+static uint8_t cgramValid;
+
+/* Bar graph cells with 1..4 of the 5 pixel columns lit, left aligned */
+static const uint8_t barGlyph[4][LCD_GLYPH_ROWS] = {
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C},
+    {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E},
+};
+
+/* Big digit segments: top bar, bottom bar, top and bottom bars */
+#define BIG_T       (LCD_SLOT_BIG + 0)
+#define BIG_B       (LCD_SLOT_BIG + 1)
+#define BIG_TB      (LCD_SLOT_BIG + 2)
+#define BIG_F       LCD_CHAR_FULL
+#define BIG_SP      LCD_CHAR_BLANK
+
+static const uint8_t bigGlyph[3][LCD_GLYPH_ROWS] = {
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F},
+    {0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F},
+};
+
+/* Powers of ten for the formatter, digits are produced by repeated subtraction */
+static const uint32_t pow10Tab[10] = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL,
+    1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+/* 3x2 cell layout of each digit, top row then bottom row */
+static const uint8_t bigDigit[10][2][LCD_BIG_DIGIT_WIDTH] = {
+    {{BIG_F,  BIG_T,  BIG_F }, {BIG_F,  BIG_B,  BIG_F }},
+    {{BIG_T,  BIG_F,  BIG_SP}, {BIG_B,  BIG_F,  BIG_B }},
+    {{BIG_TB, BIG_TB, BIG_F }, {BIG_F,  BIG_B,  BIG_B }},
+    {{BIG_TB, BIG_TB, BIG_F }, {BIG_B,  BIG_B,  BIG_F }},
+    {{BIG_F,  BIG_B,  BIG_F }, {BIG_SP, BIG_SP, BIG_F }},
+    {{BIG_F,  BIG_TB, BIG_TB}, {BIG_B,  BIG_B,  BIG_F }},
+    {{BIG_F,  BIG_TB, BIG_TB}, {BIG_F,  BIG_B,  BIG_F }},
+    {{BIG_T,  BIG_T,  BIG_F }, {BIG_SP, BIG_SP, BIG_F }},
+    {{BIG_F,  BIG_TB, BIG_F }, {BIG_F,  BIG_B,  BIG_F }},
+    {{BIG_F,  BIG_TB, BIG_F }, {BIG_B,  BIG_B,  BIG_F }},
+};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/**
+  * @brief send_to_lcd Function will Send data to LCD(parallel).
+  * @param  data sending data
+  * @param  rs register select output
+  * @retval none
+  */
+void send_to_lcd (char data, int rs)
+{
+    REG_SELECT	= (rs & 0x01);
+
+#ifdef LCD_NIBBLE_PORT
+    /* data pins form one nibble of a port, write them in one go */
+    LCD_NIBBLE_PORT = (uint8_t)((LCD_NIBBLE_PORT & (uint8_t)~LCD_NIBBLE_MASK)
+                    | (((uint8_t)data << LCD_NIBBLE_SHIFT) & LCD_NIBBLE_MASK));
+#else
+    /* write the data to the respective pin */
+    DATA_PIN7	= ((data>>3) & 0x01);
+    DATA_PIN6	= ((data>>2) & 0x01);
+    DATA_PIN5	= ((data>>1) & 0x01);
+    DATA_PIN4	= ((data>>0) & 0x01);
+#endif
+
+    /* Toggle EN PIN to send the data
+    * if the HCLK > 100 MHz, use the  20 us delay
+    * if the LCD still doesn't work, increase the delay to 50, 80 or 100..
+    */
+    ENABLE	= 1;
+    Delay_Us(100);
+
+    ENABLE	= 0;
+    Delay_Us(100);
+
+}
+
+/**
+  * @brief lcd_send_cmd Function will Send Command.
+  * @param  cmd Display command
+  * @retval none
+  */
+void lcd_send_cmd (char cmd)
+{
+    char datatosend;
+
+    /* send upper nibble first
+    RS Must be LOW while sending Command */
+    datatosend = ((cmd>>4)&0x0f);
+    send_to_lcd(datatosend,0);
+
+    /* send Lower Nibble 
+    RS Must be LOW while sending Command */
+    datatosend = ((cmd)&0x0f);
+    send_to_lcd(datatosend, 0);
+}
+
+/**
+  * @brief lcd_send_data Function will Send Data.
+  * @param  data Display Data
+  * @retval none
+  */
+void lcd_send_data (char data)
+{
+    char datatosend;
+
+    /* send higher nibble
+    RS Must be HIGH while sending Data */
+    datatosend = ((data>>4)&0x0f);
+    send_to_lcd(datatosend, 1);
+
+    /* send Lower nibble
+    RS Must be HIGH while sending Data */
+    datatosend = ((data)&0x0f);
+    send_to_lcd(datatosend, 1);
+}
+
+/**
+  * @brief lcd_clear Function will Clear Display.
+  * @param  none
+  * @retval none
+  */
+void lcd_clear (void)
+{
+    lcd_send_cmd(0x01);
+    Delay_Ms(2);
+}
+
+/**
+  * @brief lcd_put_cur Function will Set the Curser on 16x2 Display.
+  * @param  row - Row number
+  * @param  col - column number
+  * @retval none
+  */
+void lcd_put_cur(int row, int col)
+{
+    switch (row)
+    {
+        case 0:
+            col |= 0x80;
+            break;
+        case 1:
+            col |= 0xC0;
+            break;
+    }
+
+    lcd_send_cmd (col);
+}
+
+
+/**
+  * @brief lcd_init Function will initialize the LCD.
+  * @param  none
+  * @retval none
+  */
+void lcd_init (void)
+{
+    READ_DATA = 0;
+
+    /* 4 bit initialisation
+    The controller is still in 8-bit mode here, so each wake-up command is a
+    single nibble (one enable strobe); a second nibble would leave the 4-bit
+    interface one nibble out of step */
+    Delay_Ms(50);  /* wait for >40ms */
+    send_to_lcd (0x03, 0);
+    Delay_Ms(5);  /* wait for >4.1ms */
+    send_to_lcd (0x03, 0);
+    Delay_Ms(1);  /* wait for >100us */
+    send_to_lcd (0x03, 0);
+    Delay_Ms(10);
+
+    /* 4bit mode */
+    send_to_lcd (0x02, 0);
+    Delay_Ms(10);
+
+    /* dislay initialisation  */
+    /* Function set --> DL=0 (4 bit mode), N = 1 (2 line display) F = 0 (5x8 characters) */
+    lcd_send_cmd (0x28);
+    Delay_Ms(1);
+
+    /* Display on/off control --> D=0,C=0, B=0  ---> display off */
+    lcd_send_cmd (0x08);
+    Delay_Ms(1);
+
+    /* clear display */
+    lcd_send_cmd (0x01);
+    Delay_Ms(1);
+    Delay_Ms(1);
+
+    lcd_send_cmd (0x06);
+    Delay_Ms(1);
+
+    /* Display on/off control --> D = 1, C and B = 0. (Cursor and blink, last two bits) */
+    lcd_send_cmd (0x0C);
+
+    /* CGRAM content is undefined after power up */
+    lcd_glyph_invalidate();
+}
+
+/**
+  * @brief lcd_send_string Function will Send String data.
+  * @param  str display data
+  * @retval none
+  */
+void lcd_send_string (char *str)
+{
+    while (*str) lcd_send_data (*str++);
+}
+
+/**
+  * @brief lcd_glyph_invalidate Function will forget the CGRAM contents,
+  *        so every glyph is uploaded again on its next use.
+  * @param  none
+  * @retval none
+  */
+void lcd_glyph_invalidate (void)
+{
+    cgramValid = 0;
+}
+
+/**
+  * @brief lcd_glyph_load Function will place a 5x8 glyph in a CGRAM slot.
+  *        The upload is skipped when the slot already holds the same rows,
+  *        so renderers can call it every frame. After an upload the address
+  *        counter points into CGRAM; call lcd_put_cur() before writing text.
+  * @param  slot  - CGRAM slot 0..7, displayed as character code slot
+  * @param  glyph - 8 rows, pixel columns in bits 4..0
+  * @retval none
+  */
+void lcd_glyph_load (uint8_t slot, const uint8_t *glyph)
+{
+    uint8_t i;
+
+    if (slot >= LCD_CGRAM_SLOTS)
+    {
+        return;
+    }
+    if (cgramValid & (1U << slot))
+    {
+        for (i = 0; (i < LCD_GLYPH_ROWS) && (cgramRows[slot][i] == glyph[i]); i++)
+        {
+        }
+        if (i == LCD_GLYPH_ROWS)
+        {
+            return;
+        }
+    }
+
+    /* Set CGRAM address --> 0x40 | slot * 8 */
+    lcd_send_cmd (0x40 | (slot << 3));
+    for (i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        lcd_send_data (glyph[i]);
+        cgramRows[slot][i] = glyph[i];
+    }
+    cgramValid |= (uint8_t)(1U << slot);
+}
+
+/**
+  * @brief lcd_bar_graph Function will draw a horizontal bar with 5 steps per cell.
+  *        Only the width cells of the bar are written, clipped to the row.
+  * @param  row   - Row number, 0..LCD_ROWS-1
+  * @param  col   - first column of the bar
+  * @param  width - bar length in cells
+  * @param  value - value to show, clipped to max
+  * @param  max   - value shown as a full bar
+  * @retval none
+  */
+void lcd_bar_graph (int row, int col, int width, uint16_t value, uint16_t max)
+{
+    uint16_t pixels;
+    int i;
+
+    if ((row < 0) || (row >= LCD_ROWS) || (col < 0) || (col >= LCD_COLS) || (max == 0))
+    {
+        return;
+    }
+    if (width > (LCD_COLS - col))
+    {
+        width = LCD_COLS - col;
+    }
+    if (width <= 0)
+    {
+        return;
+    }
+    if (value > max)
+    {
+        value = max;
+    }
+    pixels = (uint16_t)(((uint32_t)value * (uint32_t)width * 5U) / max);
+
+    for (i = 0; i < 4; i++)
+    {
+        lcd_glyph_load (LCD_SLOT_BAR + i, barGlyph[i]);
+    }
+
+    lcd_put_cur (row, col);
+    for (i = 0; i < width; i++)
+    {
+        if (pixels >= 5)
+        {
+            lcd_send_data (LCD_CHAR_FULL);
+            pixels -= 5;
+        }
+        else if (pixels > 0)
+        {
+            lcd_send_data (LCD_SLOT_BAR + pixels - 1);
+            pixels = 0;
+        }
+        else
+        {
+            lcd_send_data (LCD_CHAR_BLANK);
+        }
+    }
+}
+
+/**
+  * @brief lcd_big_digit Function will draw a digit 3 cells wide over both rows.
+  * @param  col   - first column of the digit
+  * @param  digit - 0..9, anything else draws a blank
+  * @retval none
+  */
+void lcd_big_digit (int col, uint8_t digit)
+{
+    uint8_t row, i;
+
+    for (i = 0; i < 3; i++)
+    {
+        lcd_glyph_load (LCD_SLOT_BIG + i, bigGlyph[i]);
+    }
+
+    for (row = 0; row < LCD_ROWS; row++)
+    {
+        lcd_put_cur (row, col);
+        for (i = 0; i < LCD_BIG_DIGIT_WIDTH; i++)
+        {
+            lcd_send_data ((digit < 10) ? bigDigit[digit][row][i] : LCD_CHAR_BLANK);
+        }
+    }
+}
+
+/**
+  * @brief lcd_big_number Function will draw a right aligned number in big digits,
+  *        one blank column between digits and blanks in place of leading zeros.
+  * @param  col    - first column of the field
+  * @param  value  - number to show
+  * @param  digits - field width in digits (4 fill a 16 column row)
+  * @retval none
+  */
+void lcd_big_number (int col, uint16_t value, int digits)
+{
+    int i;
+    uint8_t digit;
+    int pos;
+
+    for (i = digits - 1; i >= 0; i--)
+    {
+        pos = col + (i * (LCD_BIG_DIGIT_WIDTH + 1));
+
+        /* the least significant digit is always shown */
+        digit = ((value != 0) || (i == digits - 1)) ? (value % 10) : 0xFF;
+        value /= 10;
+        lcd_big_digit (pos, digit);
+
+        /* gap column after each digit but the last */
+        if ((i < digits - 1) && ((pos + LCD_BIG_DIGIT_WIDTH) < LCD_COLS))
+        {
+            lcd_put_cur (0, pos + LCD_BIG_DIGIT_WIDTH);
+            lcd_send_data (LCD_CHAR_BLANK);
+            lcd_put_cur (1, pos + LCD_BIG_DIGIT_WIDTH);
+            lcd_send_data (LCD_CHAR_BLANK);
+        }
+    }
+}
+
+/**
+  * @brief lcd_fmt_pad Function will send a fill character count times.
+  * @param  out   - character sink
+  * @param  fill  - fill character
+  * @param  count - number of characters
+  * @retval none
+  */
+static void lcd_fmt_pad (lcd_putc_t out, char fill, int count)
+{
+    while (count-- > 0)
+    {
+        out (fill);
+    }
+}
+
+/**
+  * @brief lcd_fmt_number Function will send a number right or left aligned in a field.
+  *        Digits are generated most significant first by subtracting powers of ten,
+  *        so neither a buffer nor a 32 bit division is needed. A value that does not
+  *        fit the field fills it with '*' so the layout of the row is kept.
+  * @param  out   - character sink
+  * @param  mag   - magnitude of the value
+  * @param  neg   - non-zero for a leading '-'
+  * @param  dec   - digits after the decimal point (value is scaled by 10^dec)
+  * @param  width - field width, 0 for as wide as needed
+  * @param  left  - non-zero to left align
+  * @param  zero  - non-zero to pad with leading zeros
+  * @retval characters sent
+  */
+static int lcd_fmt_number (lcd_putc_t out, uint32_t mag, int neg, int dec,
+                           int width, int left, int zero)
+{
+    int ndig = 1;
+    int len, pad, i;
+    uint32_t p;
+    char d;
+
+    if (dec > 9)
+    {
+        dec = 9;
+    }
+    while ((ndig < 10) && (mag >= pow10Tab[ndig]))
+    {
+        ndig++;
+    }
+    if (ndig < dec + 1)
+    {
+        /* at least one digit before the point, "0.05" */
+        ndig = dec + 1;
+    }
+
+    len = ndig + ((dec > 0) ? 1 : 0) + ((neg) ? 1 : 0);
+    if ((width > 0) && (len > width))
+    {
+        lcd_fmt_pad (out, '*', width);
+        return width;
+    }
+    pad = (width > len) ? (width - len) : 0;
+
+    if (!left && !zero)
+    {
+        lcd_fmt_pad (out, ' ', pad);
+    }
+    if (neg)
+    {
+        out ('-');
+    }
+    if (!left && zero)
+    {
+        lcd_fmt_pad (out, '0', pad);
+    }
+
+    for (i = ndig; i > 0; i--)
+    {
+        if (i == dec)
+        {
+            out ('.');
+        }
+        p = pow10Tab[i - 1];
+        d = '0';
+        while (mag >= p)
+        {
+            mag -= p;
+            d++;
+        }
+        out (d);
+    }
+
+    if (left)
+    {
+        lcd_fmt_pad (out, ' ', pad);
+    }
+
+    return len + pad;
+}
+
+/**
+  * @brief lcd_vformat Function will format text straight into a character sink.
+  *        No heap, no libc printf and no intermediate buffer are used.
+  *        Conversions : %[-][0][width][.prec][l]type
+  *          d, u - int / unsigned int (long / unsigned long with l)
+  *          f    - fixed point: an int (long with l) holding value * 10^prec
+  *          s    - string, prec limits the characters taken, NULL prints "(null)"
+  *          c    - character
+  *          %    - literal '%'
+  *        Text outside conversions (labels, units) is copied as is.
+  * @param  out - character sink
+  * @param  fmt - format string
+  * @param  ap  - arguments
+  * @retval characters sent
+  */
+int lcd_vformat (lcd_putc_t out, const char *fmt, va_list ap)
+{
+    int count = 0;
+    int left, zero, width, prec, lng, len;
+    uint32_t mag;
+    int32_t sval;
+    const char *str;
+    char c;
+
+    while ((c = *fmt++) != '\0')
+    {
+        if (c != '%')
+        {
+            out (c);
+            count++;
+            continue;
+        }
+
+        left = 0;
+        zero = 0;
+        width = 0;
+        prec = -1;
+        lng = 0;
+
+        if (*fmt == '-')
+        {
+            left = 1;
+            fmt++;
+        }
+        if (*fmt == '0')
+        {
+            zero = 1;
+            fmt++;
+        }
+        while ((*fmt >= '0') && (*fmt <= '9'))
+        {
+            width = (width * 10) + (*fmt++ - '0');
+        }
+        if (*fmt == '.')
+        {
+            fmt++;
+            prec = 0;
+            while ((*fmt >= '0') && (*fmt <= '9'))
+            {
+                prec = (prec * 10) + (*fmt++ - '0');
+            }
+        }
+        if (*fmt == 'l')
+        {
+            lng = 1;
+            fmt++;
+        }
+
+        switch (c = *fmt++)
+        {
+            case 'd':
+            case 'f':
+                sval = (lng) ? va_arg(ap, long) : (int32_t)va_arg(ap, int);
+                mag = (sval < 0) ? (0UL - (uint32_t)sval) : (uint32_t)sval;
+                count += lcd_fmt_number(out, mag, (sval < 0),
+                                        ((c == 'f') && (prec > 0)) ? prec : 0,
+                                        width, left, zero);
+                break;
+
+            case 'u':
+                mag = (lng) ? va_arg(ap, unsigned long) : (uint32_t)va_arg(ap, unsigned int);
+                count += lcd_fmt_number(out, mag, 0, 0, width, left, zero);
+                break;
+
+            case 's':
+                str = va_arg(ap, const char *);
+                if (str == NULL)
+                {
+                    str = "(null)";
+                }
+                for (len = 0; str[len] && ((prec < 0) || (len < prec)); len++)
+                {
+                }
+                if (!left)
+                {
+                    lcd_fmt_pad(out, ' ', width - len);
+                }
+                for (mag = 0; mag < (uint32_t)len; mag++)
+                {
+                    out (str[mag]);
+                }
+                if (left)
+                {
+                    lcd_fmt_pad(out, ' ', width - len);
+                }
+                count += (width > len) ? width : len;
+                break;
+
+            case 'c':
+                if (!left)
+                {
+                    lcd_fmt_pad(out, ' ', width - 1);
+                }
+                out ((char)va_arg(ap, int));
+                if (left)
+                {
+                    lcd_fmt_pad(out, ' ', width - 1);
+                }
+                count += (width > 1) ? width : 1;
+                break;
+
+            case '%':
+                out ('%');
+                count++;
+                break;
+
+            case '\0':
+                /* format ended inside a conversion */
+                return count;
+
+            default:
+                break;
+        }
+    }
+
+    return count;
+}
+
+/**
+  * @brief lcd_format Function will format text into a character sink.
+  * @param  out - character sink
+  * @param  fmt - format string, see lcd_vformat()
+  * @retval characters sent
+  */
+int lcd_format (lcd_putc_t out, const char *fmt, ...)
+{
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+    count = lcd_vformat(out, fmt, ap);
+    va_end(ap);
+
+    return count;
+}
+
+/**
+  * @brief lcd_printf Function will format a field straight onto the display.
+  *        With fixed widths the field is overwritten in place, e.g.
+  *        lcd_printf(0, 0, "%5.1fV %3uHz", volt_x10, freq);
+  * @param  row - Row number
+  * @param  col - column number
+  * @param  fmt - format string, see lcd_vformat()
+  * @retval characters written
+  */
+int lcd_printf (int row, int col, const char *fmt, ...)
+{
+    va_list ap;
+    int count;
+
+    lcd_put_cur(row, col);
+    va_start(ap, fmt);
+    count = lcd_vformat(lcd_send_data, fmt, ap);
+    va_end(ap);
+
+    return count;
+}
+
+
 /*********************************END OF FILE*********************************/
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*
+ * hd44780_model.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: Yoganathan V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+#ifndef SIM_INC_HD44780_MODEL_H_
+#define SIM_INC_HD44780_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+
+/* Define ------------------------------------------------------------*/
+#define HD44780_ROWS                2
+#define HD44780_COLS                16
+#define HD44780_DDRAM_SIZE          0x80
+#define HD44780_CGRAM_SIZE          64
+
+/* Timing from the HD44780U datasheet (ns) */
+#define HD44780_T_POWER_ON_NS       40000000UL  /* Vcc rise to first write   */
+#define HD44780_T_EXEC_NS           37000UL     /* most instructions, writes */
+#define HD44780_T_EXEC_LONG_NS      1520000UL   /* clear display, home       */
+#define HD44780_T_WAKE1_NS          4100000UL   /* after the 1st 8-bit wake  */
+#define HD44780_T_WAKE2_NS          100000UL    /* after the 2nd 8-bit wake  */
+#define HD44780_T_PW_EH_NS          450UL       /* enable high pulse width   */
+#define HD44780_T_CYC_E_NS          1000UL      /* enable cycle time         */
+#define HD44780_T_DSW_NS            195UL       /* data setup before E fall  */
+#define HD44780_T_AS_NS             60UL        /* RS setup before E rise    */
+
+#define HD44780_MAX_LOG             8
+
+/* Typedef -----------------------------------------------------------*/
+typedef struct {
+	/* controller state */
+	uint8_t     fourBit;            /* DL = 0                          */
+	uint8_t     twoLine;            /* N  = 1                          */
+	uint8_t     displayOn;          /* D                               */
+	uint8_t     cursorOn;           /* C                               */
+	uint8_t     blinkOn;            /* B                               */
+	uint8_t     entryInc;           /* I/D                             */
+	uint8_t     entryShift;         /* S                               */
+	uint8_t     addrCgram;          /* AC points into CGRAM            */
+	uint8_t     ac;                 /* address counter                 */
+	uint8_t     wakeCount;          /* 8-bit function sets seen        */
+	uint8_t     nibbleHigh;         /* 4-bit mode: pending high nibble */
+	uint8_t     nibblePending;
+	uint8_t     nibbleRs;
+	uint8_t     ddram[HD44780_DDRAM_SIZE];
+	uint8_t     cgram[HD44780_CGRAM_SIZE];
+
+	/* pin tracking */
+	uint8_t     lastEn;
+	uint8_t     lastRs;
+	uint8_t     lastData;
+	uint64_t    tEnRise;
+	uint64_t    tEnFall;
+	uint64_t    tRsChange;
+	uint64_t    tDataChange;
+	uint64_t    busyUntil;
+
+	/* statistics */
+	uint32_t    nibbles;            /* enable strobes latched          */
+	uint32_t    instructions;       /* instructions executed           */
+	uint32_t    dataWrites;         /* DDRAM / CGRAM writes            */
+	uint32_t    violations;         /* timing / protocol rule breaks   */
+	char        log[HD44780_MAX_LOG][96];
+	uint8_t     logCount;
+} HD44780_S;
+
+/* Function prototypes -----------------------------------------------*/
+void HD44780_Reset(HD44780_S *lcd);
+void HD44780_Pins(HD44780_S *lcd, uint64_t tNs, uint8_t rs, uint8_t en, uint8_t data);
+void HD44780_Render(const HD44780_S *lcd, char text[HD44780_ROWS][HD44780_COLS + 1]);
+uint8_t HD44780_DdramAt(const HD44780_S *lcd, int row, int col);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_INC_HD44780_MODEL_H_ */
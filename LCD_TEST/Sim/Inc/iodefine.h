@@ -0,0 +1,67 @@
+/*
+ * iodefine.h (host simulation)
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: Yoganathan V
+ *
+ *  Stands in for the CS+ generated iodefine.h when LCD1602.c is built on the
+ *  host. Only the ports used by the LCD wiring are provided. Every access goes
+ *  through Sim_PortAccess(), which hands the pin levels left by the previous
+ *  access to the HD44780 model and advances simulation time by one port
+ *  access, so the model sees each intermediate pin state.
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+#ifndef SIM_INC_IODEFINE_H_
+#define SIM_INC_IODEFINE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+
+/* Define ------------------------------------------------------------*/
+#define __near
+#define SIM_PORTS           16
+
+/* Typedef -----------------------------------------------------------*/
+typedef struct
+{
+    unsigned char no0:1;
+    unsigned char no1:1;
+    unsigned char no2:1;
+    unsigned char no3:1;
+    unsigned char no4:1;
+    unsigned char no5:1;
+    unsigned char no6:1;
+    unsigned char no7:1;
+} __bitf_T;
+
+typedef union
+{
+    unsigned char   byte;
+    __bitf_T        bit;
+} Sim_Port_U;
+
+/* Variables ---------------------------------------------------------*/
+extern volatile Sim_Port_U SimPort[SIM_PORTS];
+
+/* Function prototypes -----------------------------------------------*/
+volatile Sim_Port_U *Sim_PortAccess(int port);
+
+/* Macro -------------------------------------------------------------*/
+#define P1                  (Sim_PortAccess(1)->byte)
+#define P1_bit              (Sim_PortAccess(1)->bit)
+#define P4                  (Sim_PortAccess(4)->byte)
+#define P4_bit              (Sim_PortAccess(4)->bit)
+#define P5                  (Sim_PortAccess(5)->byte)
+#define P5_bit              (Sim_PortAccess(5)->bit)
+#define P11                 (Sim_PortAccess(11)->byte)
+#define P11_bit             (Sim_PortAccess(11)->bit)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_INC_IODEFINE_H_ */
@@ -0,0 +1,98 @@
+/*
+ * fmt_size.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: Yoganathan V
+ *
+ *  Code size of lcd_printf() against the libc route it replaces,
+ *  vsnprintf() into a row buffer followed by lcd_send_string(). Both
+ *  programs print the same fields; the only difference is the formatter.
+ *
+ *  Build from LCD_TEST:
+ *      gcc -Os -ffunction-sections -fdata-sections -Wl,--gc-sections -static \
+ *          -ISim/Inc -ILCD/Inc -I. Sim/fmt_size.c LCD/LCD1602.c -o fmt_lcd
+ *      gcc -Os -ffunction-sections -fdata-sections -Wl,--gc-sections -static \
+ *          -DFMT_SIZE_LIBC -ISim/Inc -ILCD/Inc -I. Sim/fmt_size.c LCD/LCD1602.c -o fmt_libc
+ *      nm -S --size-sort fmt_lcd  | grep -e lcd_fmt -e lcd_vformat -e lcd_printf -e pow10Tab
+ *      nm -S --size-sort fmt_libc | grep -e vsnprintf_internal -e vfprintf_internal \
+ *          -e printf_positional -e __printf_fp_l
+ *  A static glibc image carries its printf whatever main() calls, so the
+ *  images are the same size; compare the symbols instead. gcc 12, x86-64:
+ *      lcd_vformat 728, lcd_fmt_number 345, lcd_printf 158, pow10Tab 40,
+ *      lcd_fmt_pad 31                                      1302 bytes
+ *      __vsnprintf_internal 254, __vfprintf_internal 8785,
+ *      printf_positional 9006, __printf_fp_l 11152 (%f)    29197 bytes
+ *  Host figures are a proxy: on the RL78 read the same two builds from the
+ *  CC-RL map (.text/.const of LCD1602.obj and of the printf library module).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include "iodefine.h"
+#include "r_cg_userdefine.h"
+#include "LCD1602.h"
+
+/* Variables -----------------------------------------------------------------*/
+volatile Sim_Port_U SimPort[SIM_PORTS];
+
+/* Function prototypes -------------------------------------------------------*/
+volatile Sim_Port_U *Sim_PortAccess (int port)
+{
+    return &SimPort[port];
+}
+
+void Delay_Ms (uint16_t Cnt)
+{
+    (void)Cnt;
+}
+
+void Delay_Us (uint16_t Cnt)
+{
+    (void)Cnt;
+}
+
+#ifdef FMT_SIZE_LIBC
+/**
+  * @brief fmt_printf Function will format a field with libc and send the buffer.
+  * @param  row - Row number
+  * @param  col - column number
+  * @param  fmt - format string
+  * @retval characters written
+  */
+static int fmt_printf (int row, int col, const char *fmt, ...)
+{
+    char buf[LCD_COLS + 1];
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+    count = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+
+    lcd_put_cur(row, col);
+    lcd_send_string(buf);
+    return count;
+}
+#else
+#define fmt_printf      lcd_printf
+#endif
+
+int main (int argc, char **argv)
+{
+    (void)argv;
+
+    /* the same fields in both builds; argc keeps the values out of reach of the optimiser */
+    fmt_printf(0, 0, "%5u %-4s", (unsigned)argc * 100U, "kWh");
+    fmt_printf(1, 0, "%3d%c %ld", argc - 5, 'C', (long)argc * 100000L);
+#ifdef FMT_SIZE_LIBC
+    fmt_printf(1, 8, "%5.1fV", argc * 229.1);
+#else
+    fmt_printf(1, 8, "%5.1fV", argc * 2291);
+#endif
+
+    return 0;
+}
+
+/*********************************END OF FILE*********************************/
@@ -0,0 +1,341 @@
+/*
+ * hd44780_model.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: Yoganathan V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hd44780_model.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+/* Typedef -------------------------------------------------------------------*/
+
+/* Define --------------------------------------------------------------------*/
+#define LINE2_BASE          0x40
+#define LINE_LEN            0x28
+
+/* Macro ---------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/**
+  * @brief HD44780_Violation Function will count and log a rule break.
+  * @param  lcd - model
+  * @param  fmt - message
+  * @retval none
+  */
+static void HD44780_Violation (HD44780_S *lcd, const char *fmt, ...)
+{
+    va_list ap;
+
+    lcd->violations++;
+    if (lcd->logCount < HD44780_MAX_LOG)
+    {
+        va_start(ap, fmt);
+        vsnprintf(lcd->log[lcd->logCount++], sizeof(lcd->log[0]), fmt, ap);
+        va_end(ap);
+    }
+}
+
+/**
+  * @brief HD44780_Reset Function will put the model in its power-on state.
+  *        Internal reset leaves the controller in 8-bit mode, 1 line, display off.
+  * @param  lcd - model
+  * @retval none
+  */
+void HD44780_Reset (HD44780_S *lcd)
+{
+    memset(lcd, 0, sizeof(*lcd));
+    lcd->entryInc = 1;
+    memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+    lcd->busyUntil = HD44780_T_POWER_ON_NS;
+}
+
+/**
+  * @brief HD44780_Step Function will move the address counter after a data write.
+  * @param  lcd - model
+  * @retval none
+  */
+static void HD44780_Step (HD44780_S *lcd)
+{
+    if (lcd->addrCgram)
+    {
+        lcd->ac = (uint8_t)((lcd->ac + (lcd->entryInc ? 1 : -1)) & (HD44780_CGRAM_SIZE - 1));
+        return;
+    }
+
+    if (lcd->entryInc)
+    {
+        lcd->ac++;
+        if (lcd->twoLine)
+        {
+            if (lcd->ac == LINE_LEN)                  lcd->ac = LINE2_BASE;
+            else if (lcd->ac == LINE2_BASE + LINE_LEN) lcd->ac = 0;
+        }
+        else if (lcd->ac == 0x50)
+        {
+            lcd->ac = 0;
+        }
+    }
+    else
+    {
+        if (lcd->twoLine)
+        {
+            if (lcd->ac == 0)                  lcd->ac = LINE2_BASE + LINE_LEN - 1;
+            else if (lcd->ac == LINE2_BASE)    lcd->ac = LINE_LEN - 1;
+            else                               lcd->ac--;
+        }
+        else
+        {
+            lcd->ac = (lcd->ac == 0) ? 0x4F : (uint8_t)(lcd->ac - 1);
+        }
+    }
+}
+
+/**
+  * @brief HD44780_Execute Function will run one complete 8-bit instruction or data write.
+  * @param  lcd - model
+  * @param  tNs - time of the enable falling edge
+  * @param  rs  - register select
+  * @param  val - instruction / data byte
+  * @retval none
+  */
+static void HD44780_Execute (HD44780_S *lcd, uint64_t tNs, uint8_t rs, uint8_t val)
+{
+    uint64_t exec = HD44780_T_EXEC_NS;
+
+    if (rs)
+    {
+        lcd->dataWrites++;
+        if (lcd->addrCgram)
+        {
+            lcd->cgram[lcd->ac & (HD44780_CGRAM_SIZE - 1)] = val & 0x1F;
+        }
+        else
+        {
+            lcd->ddram[lcd->ac & (HD44780_DDRAM_SIZE - 1)] = val;
+        }
+        HD44780_Step(lcd);
+        lcd->busyUntil = tNs + exec;
+        return;
+    }
+
+    lcd->instructions++;
+    if (val & 0x80)
+    {
+        /* Set DDRAM address */
+        lcd->ac = val & 0x7F;
+        lcd->addrCgram = 0;
+        if (lcd->twoLine && ((lcd->ac & 0x3F) >= LINE_LEN))
+        {
+            HD44780_Violation(lcd, "t=%lluns DDRAM address 0x%02X outside a line",
+                              (unsigned long long)tNs, lcd->ac);
+        }
+    }
+    else if (val & 0x40)
+    {
+        /* Set CGRAM address */
+        lcd->ac = val & 0x3F;
+        lcd->addrCgram = 1;
+    }
+    else if (val & 0x20)
+    {
+        /* Function set */
+        lcd->fourBit = (val & 0x10) ? 0 : 1;
+        if (!lcd->fourBit)
+        {
+            /* 8-bit wake-up sequence wants the long waits */
+            lcd->wakeCount++;
+            if (lcd->wakeCount == 1)      exec = HD44780_T_WAKE1_NS;
+            else if (lcd->wakeCount == 2) exec = HD44780_T_WAKE2_NS;
+        }
+        else
+        {
+            lcd->twoLine = (val & 0x08) ? 1 : 0;
+        }
+    }
+    else if (val & 0x10)
+    {
+        /* Cursor / display shift, not modelled beyond the cursor move */
+        if (!(val & 0x08))
+        {
+            uint8_t inc = lcd->entryInc;
+            lcd->entryInc = (val & 0x04) ? 1 : 0;
+            HD44780_Step(lcd);
+            lcd->entryInc = inc;
+        }
+    }
+    else if (val & 0x08)
+    {
+        lcd->displayOn = (val & 0x04) ? 1 : 0;
+        lcd->cursorOn  = (val & 0x02) ? 1 : 0;
+        lcd->blinkOn   = (val & 0x01) ? 1 : 0;
+    }
+    else if (val & 0x04)
+    {
+        lcd->entryInc   = (val & 0x02) ? 1 : 0;
+        lcd->entryShift = (val & 0x01) ? 1 : 0;
+    }
+    else if (val & 0x02)
+    {
+        /* Return home */
+        lcd->ac = 0;
+        lcd->addrCgram = 0;
+        exec = HD44780_T_EXEC_LONG_NS;
+    }
+    else if (val & 0x01)
+    {
+        /* Clear display */
+        memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+        lcd->ac = 0;
+        lcd->addrCgram = 0;
+        lcd->entryInc = 1;
+        exec = HD44780_T_EXEC_LONG_NS;
+    }
+
+    lcd->busyUntil = tNs + exec;
+}
+
+/**
+  * @brief HD44780_Pins Function will feed the current pin levels to the model.
+  *        Call it whenever the pins may have changed; a nibble is latched on
+  *        the falling edge of E and the timing rules are checked there.
+  * @param  lcd  - model
+  * @param  tNs  - simulation time
+  * @param  rs   - RS level
+  * @param  en   - E level
+  * @param  data - D7..D4 as bits 3..0
+  * @retval none
+  */
+void HD44780_Pins (HD44780_S *lcd, uint64_t tNs, uint8_t rs, uint8_t en, uint8_t data)
+{
+    uint8_t val;
+
+    data &= 0x0F;
+    rs = rs ? 1 : 0;
+    en = en ? 1 : 0;
+
+    if (rs != lcd->lastRs)
+    {
+        if (lcd->lastEn)
+        {
+            HD44780_Violation(lcd, "t=%lluns RS changed while E high", (unsigned long long)tNs);
+        }
+        lcd->tRsChange = tNs;
+        lcd->lastRs = rs;
+    }
+    if (data != lcd->lastData)
+    {
+        lcd->tDataChange = tNs;
+        lcd->lastData = data;
+    }
+
+    if (en && !lcd->lastEn)
+    {
+        /* E rising edge */
+        if ((tNs - lcd->tRsChange) < HD44780_T_AS_NS)
+        {
+            HD44780_Violation(lcd, "t=%lluns RS setup %lluns < %luns", (unsigned long long)tNs,
+                              (unsigned long long)(tNs - lcd->tRsChange), HD44780_T_AS_NS);
+        }
+        if ((lcd->nibbles != 0) && ((tNs - lcd->tEnRise) < HD44780_T_CYC_E_NS))
+        {
+            HD44780_Violation(lcd, "t=%lluns E cycle %lluns < %luns", (unsigned long long)tNs,
+                              (unsigned long long)(tNs - lcd->tEnRise), HD44780_T_CYC_E_NS);
+        }
+        lcd->tEnRise = tNs;
+    }
+    else if (!en && lcd->lastEn)
+    {
+        /* E falling edge latches D7..D4 */
+        lcd->tEnFall = tNs;
+        lcd->nibbles++;
+
+        if ((tNs - lcd->tEnRise) < HD44780_T_PW_EH_NS)
+        {
+            HD44780_Violation(lcd, "t=%lluns E pulse %lluns < %luns", (unsigned long long)tNs,
+                              (unsigned long long)(tNs - lcd->tEnRise), HD44780_T_PW_EH_NS);
+        }
+        if ((tNs - lcd->tDataChange) < HD44780_T_DSW_NS)
+        {
+            HD44780_Violation(lcd, "t=%lluns data setup %lluns < %luns", (unsigned long long)tNs,
+                              (unsigned long long)(tNs - lcd->tDataChange), HD44780_T_DSW_NS);
+        }
+        if (tNs < lcd->busyUntil)
+        {
+            HD44780_Violation(lcd, "t=%lluns write %lluns before the controller is ready",
+                              (unsigned long long)tNs, (unsigned long long)(lcd->busyUntil - tNs));
+        }
+
+        if (!lcd->fourBit)
+        {
+            /* 8-bit interface: D3..D0 are not wired and read high (internal pull-ups) */
+            HD44780_Execute(lcd, tNs, rs, (uint8_t)((data << 4) | 0x0F));
+        }
+        else if (!lcd->nibblePending)
+        {
+            lcd->nibbleHigh = data;
+            lcd->nibbleRs = rs;
+            lcd->nibblePending = 1;
+        }
+        else
+        {
+            lcd->nibblePending = 0;
+            if (rs != lcd->nibbleRs)
+            {
+                HD44780_Violation(lcd, "t=%lluns RS differs between the two nibbles",
+                                  (unsigned long long)tNs);
+            }
+            val = (uint8_t)((lcd->nibbleHigh << 4) | data);
+            HD44780_Execute(lcd, tNs, rs, val);
+        }
+    }
+    lcd->lastEn = en;
+}
+
+/**
+  * @brief HD44780_DdramAt Function will return the character code shown at a position.
+  * @param  lcd - model
+  * @param  row - Row number
+  * @param  col - column number
+  * @retval character code
+  */
+uint8_t HD44780_DdramAt (const HD44780_S *lcd, int row, int col)
+{
+    return lcd->ddram[((row ? LINE2_BASE : 0) + col) & (HD44780_DDRAM_SIZE - 1)];
+}
+
+/**
+  * @brief HD44780_Render Function will print the visible 2x16 window as text.
+  *        CGRAM characters (codes 0..7) are rendered as '*', the ROM full
+  *        block as '#' and other non ASCII codes as '?'.
+  * @param  lcd  - model
+  * @param  text - one NUL terminated string per row
+  * @retval none
+  */
+void HD44780_Render (const HD44780_S *lcd, char text[HD44780_ROWS][HD44780_COLS + 1])
+{
+    int row, col;
+    uint8_t c;
+
+    for (row = 0; row < HD44780_ROWS; row++)
+    {
+        for (col = 0; col < HD44780_COLS; col++)
+        {
+            c = HD44780_DdramAt(lcd, row, col);
+            if (!lcd->displayOn || ((row == 1) && !lcd->twoLine))  c = ' ';
+            else if (c < 0x08)                                     c = '*';
+            else if (c == 0xFF)                                    c = '#';
+            else if ((c < 0x20) || (c > 0x7E))                     c = '?';
+            text[row][col] = (char)c;
+        }
+        text[row][HD44780_COLS] = '\0';
+    }
+}
+
+/*********************************END OF FILE*********************************/
@@ -0,0 +1,396 @@
+/*
+ * lcd_sim.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: Yoganathan V
+ *
+ *  Host simulation of the LCD1602 driver against an HD44780 model.
+ *  The unmodified LCD/LCD1602.c is compiled with the stub iodefine.h from
+ *  Sim/Inc, the delays advance simulation time instead of spinning, and
+ *  every port access is replayed into the model. The program checks the
+ *  init sequence, lcd_put_cur() addressing, the glyph cache and the field
+ *  formatter, then reports the bus transactions and bus time of typical
+ *  screen updates.
+ *
+ *  Build and run from LCD_TEST:
+ *      gcc -O2 -ISim/Inc -ILCD/Inc -I. Sim/lcd_sim.c Sim/hd44780_model.c LCD/LCD1602.c -o lcd_sim
+ *      ./lcd_sim
+ *  The exit status is non-zero when a check fails.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "iodefine.h"
+#include "r_cg_userdefine.h"
+#include "LCD1602.h"
+#include "hd44780_model.h"
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+    uint64_t    tNs;
+    uint32_t    nibbles;
+} Sim_Mark_S;
+
+/* Define --------------------------------------------------------------------*/
+/* One SET1/CLR1 or MOV on an SFR at fCLK = 32 MHz */
+#ifndef SIM_PORT_ACCESS_NS
+#define SIM_PORT_ACCESS_NS      63U
+#endif
+
+/* Macro ---------------------------------------------------------------------*/
+#define SIM_CHECK(cond, ...)                                        \
+    do {                                                            \
+        if (!(cond)) {                                              \
+            printf("  FAIL: " __VA_ARGS__);                         \
+            printf("\n");                                           \
+            simFailures++;                                          \
+        }                                                           \
+    } while (0)
+
+/* Variables -----------------------------------------------------------------*/
+volatile Sim_Port_U SimPort[SIM_PORTS];
+
+static HD44780_S    simLcd;
+static uint64_t     simTimeNs;
+static int          simQuiet;
+static int          simFailures;
+
+/* Function prototypes -------------------------------------------------------*/
+
+/**
+  * @brief Sim_Sync Function will hand the current LCD pin levels to the model.
+  * @param  none
+  * @retval none
+  */
+static void Sim_Sync (void)
+{
+    uint8_t rs, en, data;
+
+    /* read the pins through the driver's own macros without counting accesses */
+    simQuiet = 1;
+    rs   = REG_SELECT;
+    en   = ENABLE;
+    data = (uint8_t)((DATA_PIN7 << 3) | (DATA_PIN6 << 2) | (DATA_PIN5 << 1) | DATA_PIN4);
+    simQuiet = 0;
+
+    HD44780_Pins(&simLcd, simTimeNs, rs, en, data);
+}
+
+/**
+  * @brief Sim_PortAccess Function is called by every port access of the driver.
+  * @param  port - port number
+  * @retval port storage
+  */
+volatile Sim_Port_U *Sim_PortAccess (int port)
+{
+    if (!simQuiet)
+    {
+        Sim_Sync();
+        simTimeNs += SIM_PORT_ACCESS_NS;
+    }
+    return &SimPort[port];
+}
+
+void Delay_Ms (uint16_t Cnt)
+{
+    Sim_Sync();
+    simTimeNs += (uint64_t)Cnt * 1000000ULL;
+    Sim_Sync();
+}
+
+void Delay_Us (uint16_t Cnt)
+{
+    Sim_Sync();
+    simTimeNs += (uint64_t)Cnt * 1000ULL;
+    Sim_Sync();
+}
+
+/**
+  * @brief Sim_PowerOn Function will reset the ports, the model and the clock.
+  * @param  none
+  * @retval none
+  */
+static void Sim_PowerOn (void)
+{
+    int i;
+
+    for (i = 0; i < SIM_PORTS; i++)
+    {
+        SimPort[i].byte = 0;
+    }
+    simTimeNs = 0;
+    HD44780_Reset(&simLcd);
+}
+
+static Sim_Mark_S Sim_Mark (void)
+{
+    Sim_Mark_S m;
+
+    Sim_Sync();
+    m.tNs = simTimeNs;
+    m.nibbles = simLcd.nibbles;
+    return m;
+}
+
+static void Sim_Report (const char *what, Sim_Mark_S from)
+{
+    Sim_Mark_S to = Sim_Mark();
+
+    printf("  %-28s %6lu nibbles %10.1f us\n", what,
+           (unsigned long)(to.nibbles - from.nibbles), (double)(to.tNs - from.tNs) / 1000.0);
+}
+
+static void Sim_Show (void)
+{
+    char text[HD44780_ROWS][HD44780_COLS + 1];
+    int row;
+
+    HD44780_Render(&simLcd, text);
+    printf("  +----------------+\n");
+    for (row = 0; row < HD44780_ROWS; row++)
+    {
+        printf("  |%s|\n", text[row]);
+    }
+    printf("  +----------------+\n");
+}
+
+static void Sim_ShowViolations (void)
+{
+    int i;
+
+    for (i = 0; i < simLcd.logCount; i++)
+    {
+        printf("    %s\n", simLcd.log[i]);
+    }
+}
+
+/**
+  * @brief Sim_TestInit Function will check the state left by lcd_init().
+  * @param  none
+  * @retval none
+  */
+static void Sim_TestInit (void)
+{
+    int row, col;
+
+    printf("init sequence\n");
+    Sim_PowerOn();
+    lcd_init();
+    Sim_Sync();
+
+    SIM_CHECK(simLcd.violations == 0, "%lu timing/protocol violations", (unsigned long)simLcd.violations);
+    Sim_ShowViolations();
+    SIM_CHECK(simLcd.fourBit, "interface not in 4-bit mode");
+    SIM_CHECK(!simLcd.nibblePending, "controller left half way through a byte (nibble sync lost)");
+    SIM_CHECK(simLcd.twoLine, "function set did not select 2 lines");
+    SIM_CHECK(simLcd.displayOn && !simLcd.cursorOn && !simLcd.blinkOn, "display control is not D=1 C=0 B=0");
+    SIM_CHECK(simLcd.entryInc && !simLcd.entryShift, "entry mode is not increment / no shift");
+    for (row = 0; row < HD44780_ROWS; row++)
+    {
+        for (col = 0; col < HD44780_COLS; col++)
+        {
+            SIM_CHECK(HD44780_DdramAt(&simLcd, row, col) == ' ', "DDRAM not cleared at %d,%d", row, col);
+        }
+    }
+    printf("  %lu instructions, %.1f ms\n", (unsigned long)simLcd.instructions, (double)simTimeNs / 1e6);
+}
+
+/**
+  * @brief Sim_TestPutCur Function will check lcd_put_cur() against the DDRAM map.
+  * @param  none
+  * @retval none
+  */
+static void Sim_TestPutCur (void)
+{
+    int row, col;
+    char c;
+    uint32_t before = simLcd.violations;
+
+    printf("lcd_put_cur addressing\n");
+    for (row = 0; row < HD44780_ROWS; row++)
+    {
+        for (col = HD44780_COLS - 1; col >= 0; col--)
+        {
+            c = (char)('A' + (row * HD44780_COLS + col) % 26);
+            lcd_put_cur(row, col);
+            lcd_send_data(c);
+            Sim_Sync();
+            SIM_CHECK(HD44780_DdramAt(&simLcd, row, col) == (uint8_t)c,
+                      "lcd_put_cur(%d, %d) wrote DDRAM 0x%02X", row, col, (unsigned)(simLcd.ac - 1));
+        }
+    }
+    SIM_CHECK(simLcd.violations == before, "%lu violations", (unsigned long)(simLcd.violations - before));
+    Sim_ShowViolations();
+    Sim_Show();
+}
+
+/**
+  * @brief Sim_TestGlyphs Function will check the CGRAM cache and bar graph clipping.
+  * @param  none
+  * @retval none
+  */
+static void Sim_TestGlyphs (void)
+{
+    uint8_t glyph[LCD_GLYPH_ROWS] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02};
+    uint8_t copy[LCD_GLYPH_ROWS];
+    uint32_t nibbles;
+    int i;
+
+    printf("glyph cache and bar graph\n");
+    for (i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        copy[i] = glyph[i];
+    }
+
+    lcd_glyph_load(LCD_SLOT_USER, glyph);
+    Sim_Sync();
+    for (i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        SIM_CHECK(simLcd.cgram[LCD_SLOT_USER * LCD_GLYPH_ROWS + i] == glyph[i], "CGRAM row %d not uploaded", i);
+    }
+
+    /* same rows from another table: no upload */
+    nibbles = simLcd.nibbles;
+    lcd_glyph_load(LCD_SLOT_USER, copy);
+    Sim_Sync();
+    SIM_CHECK(simLcd.nibbles == nibbles, "identical glyph uploaded again");
+
+    /* same table, changed rows: uploaded */
+    glyph[3] = 0x1F;
+    lcd_glyph_load(LCD_SLOT_USER, glyph);
+    Sim_Sync();
+    SIM_CHECK(simLcd.cgram[LCD_SLOT_USER * LCD_GLYPH_ROWS + 3] == 0x1F, "changed glyph not uploaded");
+
+    /* a width past the row end, and past 255, stops at the last column */
+    lcd_put_cur(1, 0);
+    lcd_send_string("0123456789ABCDEF");
+    nibbles = simLcd.nibbles;
+    lcd_bar_graph(0, 10, 300, 100, 100);
+    Sim_Sync();
+    for (i = 10; i < LCD_COLS; i++)
+    {
+        SIM_CHECK(HD44780_DdramAt(&simLcd, 0, i) == LCD_CHAR_FULL, "bar cell %d not full", i);
+    }
+    SIM_CHECK(HD44780_DdramAt(&simLcd, 1, 0) == '0', "bar ran past the row into row 1");
+    SIM_CHECK((simLcd.nibbles - nibbles) < 200U, "bar graph wrote %lu nibbles", (unsigned long)(simLcd.nibbles - nibbles));
+
+    /* a row off the display is refused: row 2, column 1 would be a clear command */
+    nibbles = simLcd.nibbles;
+    lcd_bar_graph(2, 1, 4, 50, 100);
+    lcd_bar_graph(-1, 0, 4, 50, 100);
+    Sim_Sync();
+    SIM_CHECK(simLcd.nibbles == nibbles, "bar graph on a bad row wrote %lu nibbles", (unsigned long)(simLcd.nibbles - nibbles));
+    SIM_CHECK(HD44780_DdramAt(&simLcd, 1, 0) == '0', "bar graph on a bad row cleared the display");
+}
+
+/* Formatter output collected by Sim_FmtPut() */
+static char         simFmt[64];
+static int          simFmtLen;
+
+/**
+  * @brief Sim_FmtPut Function is the character sink for the formatter checks.
+  * @param  c - character
+  * @retval none
+  */
+static void Sim_FmtPut (char c)
+{
+    if (simFmtLen < (int)sizeof(simFmt) - 1)
+    {
+        simFmt[simFmtLen++] = c;
+    }
+    simFmt[simFmtLen] = '\0';
+}
+
+#define SIM_FMT(expect, ...)                                                    \
+    do {                                                                        \
+        simFmtLen = 0;                                                          \
+        simFmt[0] = '\0';                                                       \
+        n = lcd_format(Sim_FmtPut, __VA_ARGS__);                                \
+        SIM_CHECK((strcmp(simFmt, expect) == 0) && (n == (int)strlen(expect)),  \
+                  "format \"%s\" gave \"%s\" (%d)", #__VA_ARGS__, simFmt, n);    \
+    } while (0)
+
+/**
+  * @brief Sim_TestFormat Function will check the field formatter output.
+  * @param  none
+  * @retval none
+  */
+static void Sim_TestFormat (void)
+{
+    int n;
+
+    printf("field formatter\n");
+    SIM_FMT("  230V", "%5dV", 230);
+    SIM_FMT("-0042", "%05d", -42);
+    SIM_FMT("12   |", "%-5u|", 12U);
+    SIM_FMT("-2147483648", "%ld", (long)(-2147483647L - 1));
+    SIM_FMT("4294967295", "%lu", 4294967295UL);
+    SIM_FMT("229.1V", "%5.1fV", 2291);
+    SIM_FMT(" -0.05", "%6.2f", -5);
+    SIM_FMT("***", "%3d", 1234);
+    SIM_FMT("  kWh", "%5s", "kWh");
+    SIM_FMT("ab", "%.2s", "abcdef");
+    SIM_FMT("(null)", "%s", (const char *)NULL);
+    SIM_FMT("(nu", "%.3s", (const char *)NULL);
+    SIM_FMT("x  50%", "%-3c50%%", 'x');
+}
+
+/**
+  * @brief Sim_Benchmark Function will report bus cost of typical screen updates.
+  * @param  none
+  * @retval none
+  */
+static void Sim_Benchmark (void)
+{
+    Sim_Mark_S m;
+    uint32_t cold;
+
+    printf("bus cost (port access %u ns)\n", (unsigned)SIM_PORT_ACCESS_NS);
+
+    m = Sim_Mark();
+    lcd_clear();
+    Sim_Report("lcd_clear", m);
+
+    m = Sim_Mark();
+    lcd_put_cur(0, 0);
+    lcd_send_string("VFD LOGGER  v1.0");
+    lcd_put_cur(1, 0);
+    lcd_send_string("230.5V    50.0Hz");
+    Sim_Report("full screen, 32 chars", m);
+
+    m = Sim_Mark();
+    lcd_printf(1, 0, "%5.1fV", 2291);
+    Sim_Report("lcd_printf 6 char field", m);
+
+    /* Sim_TestGlyphs() left the bar glyphs loaded; forget them for the cold figure */
+    lcd_glyph_invalidate();
+    m = Sim_Mark();
+    lcd_bar_graph(0, 0, 16, 37, 100);
+    Sim_Report("bar graph, cold glyphs", m);
+    cold = Sim_Mark().nibbles - m.nibbles;
+
+    m = Sim_Mark();
+    lcd_bar_graph(0, 0, 16, 62, 100);
+    Sim_Report("bar graph, cached glyphs", m);
+    SIM_CHECK((Sim_Mark().nibbles - m.nibbles) < cold, "cached bar graph cost as much as a cold one");
+
+    Sim_Show();
+    SIM_CHECK(simLcd.violations == 0, "%lu violations", (unsigned long)simLcd.violations);
+    Sim_ShowViolations();
+}
+
+int main (void)
+{
+    Sim_TestInit();
+    Sim_TestPutCur();
+    Sim_TestGlyphs();
+    Sim_TestFormat();
+    Sim_Benchmark();
+
+    printf("%s (%d failed checks)\n", simFailures ? "FAILED" : "PASSED", simFailures);
+    return simFailures ? 1 : 0;
+}
+
+/*********************************END OF FILE*********************************/
@@ -1,64 +1,139 @@
-/***********************************************************************************************************************
-* DISCLAIMER
-* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
-* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
-* applicable laws, including copyright laws. 
-* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
-* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
-* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
-* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
-* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
-* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
-* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
-* following link:
-* http://www.renesas.com/disclaimer
-*
-* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-* File Name    : r_cg_cgc_user.c
-* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
-* Device(s)    : R5F104ML
-* Tool-Chain   : CCRL
-* Description  : This file implements device driver for CGC module.
-* Creation Date: 2/17/2023
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Includes
-***********************************************************************************************************************/
-#include "r_cg_macrodriver.h"
-#include "r_cg_cgc.h"
-/* Start user code for include. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-#include "r_cg_userdefine.h"
-
-/***********************************************************************************************************************
-Pragma directive
-***********************************************************************************************************************/
-/* Start user code for pragma. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-
-/***********************************************************************************************************************
-Global variables and functions
-***********************************************************************************************************************/
-/* Start user code for global. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-
-/***********************************************************************************************************************
-* Function Name: R_CGC_Get_ResetSource
-* Description  : This function process of Reset.
-* Arguments    : None
-* Return Value : None
-***********************************************************************************************************************/
-void R_CGC_Get_ResetSource(void)
-{
-    uint8_t reset_flag = RESF;
-    /* Start user code. Do not edit comment generated here */
-    /* End user code. Do not edit comment generated here */
-}
-
-/* Start user code for adding. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_cgc_user.c
+* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
+* Device(s)    : R5F104ML
+* Tool-Chain   : CCRL
+* Description  : This file implements device driver for CGC module.
+* Creation Date: 2/17/2023
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "r_cg_cgc.h"
+/* Start user code for include. Do not edit comment generated here */
+#include "r_cg_wdt.h"
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+/* Start user code for pragma. Do not edit comment generated here */
+#pragma interrupt r_it_interrupt(vect=INTIT)
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_CGC_Get_ResetSource
+* Description  : This function process of Reset.
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+void R_CGC_Get_ResetSource(void)
+{
+    uint8_t reset_flag = RESF;
+    /* Start user code. Do not edit comment generated here */
+    Wdg_SaveResetSource(reset_flag);
+    /* End user code. Do not edit comment generated here */
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+
+/* Interval timer control register (ITMC) */
+#define _0000_IT_OPERATION_DISABLE  (0x0000U) /* disable interval timer operation */
+#define _8000_IT_OPERATION_ENABLE   (0x8000U) /* enable interval timer operation */
+#define IT_FSUB_COUNTS_PER_PERIOD   (4096U)   /* fSUB counts in IDLE_STOP_MAX_MS */
+
+/***********************************************************************************************************************
+* Function Name: r_it_interrupt
+* Description  : This function is INTIT interrupt service routine. It marks the STOP period as fully elapsed.
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+static void __near r_it_interrupt(void)
+{
+    IdleStats.itExpired = 1U;
+}
+
+/***********************************************************************************************************************
+* Function Name: Idle_Stop
+* Description  : This function enters STOP mode for up to IDLE_STOP_MAX_MS, using the interval timer on fSUB as the
+*                wake source. fIH and the TAU0 channels stop while in STOP, so the caller has to credit the slept time
+*                to its own counters.
+* Arguments    : Ms -
+*                    requested sleep time in ms
+* Return Value : Slept time in ms, or 0 if an interrupt other than INTIT released STOP early
+***********************************************************************************************************************/
+uint16_t Idle_Stop(uint16_t Ms)
+{
+    uint16_t counts;
+
+    if (Ms > IDLE_STOP_MAX_MS)
+    {
+        Ms = IDLE_STOP_MAX_MS;
+    }
+    if (Ms == 0U)
+    {
+        return 0U;
+    }
+    counts = (uint16_t)(((uint32_t)Ms * IT_FSUB_COUNTS_PER_PERIOD) / IDLE_STOP_MAX_MS);
+
+    RTCEN = 1U;     /* supplies input clock to RTC and interval timer */
+    ITMC = _0000_IT_OPERATION_DISABLE;
+    ITMK = 1U;      /* disable INTIT interrupt */
+    ITIF = 0U;      /* clear INTIT interrupt flag */
+    /* Set INTIT low priority */
+    ITPR1 = 1U;
+    ITPR0 = 1U;
+    ITMC = _8000_IT_OPERATION_ENABLE | (counts - 1U);
+    IdleStats.itExpired = 0U;
+
+    /* With interrupts disabled a pending request releases STOP at once instead of being lost */
+    DI();
+    ITMK = 0U;      /* enable INTIT interrupt */
+    IdleStats.stopCount++;
+    STOP();
+    EI();
+    NOP();
+
+    ITMK = 1U;      /* disable INTIT interrupt */
+    ITMC = _0000_IT_OPERATION_DISABLE;
+
+    if (IdleStats.itExpired == 0U)
+    {
+        IdleStats.stopEarlyWake++;
+        return 0U;
+    }
+    IdleStats.stopMs += Ms;
+    Wdg_CheckIn(WDG_TASK_TICK);     /* time kept through STOP, where INTTM00 does not run */
+
+    return Ms;
+}
+
+/* End user code. Do not edit comment generated here */
@@ -1,88 +1,88 @@
-/***********************************************************************************************************************
-* DISCLAIMER
-* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
-* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
-* applicable laws, including copyright laws. 
-* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
-* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
-* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
-* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
-* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
-* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
-* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
-* following link:
-* http://www.renesas.com/disclaimer
-*
-* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-* File Name    : r_cg_macrodriver.h
-* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
-* Device(s)    : R5F104ML
-* Tool-Chain   : CCRL
-* Description  : This file implements general head file.
-* Creation Date: 2/17/2023
-***********************************************************************************************************************/
-
-#ifndef STATUS_H
-#define STATUS_H
-/***********************************************************************************************************************
-Includes
-***********************************************************************************************************************/
-#include "iodefine.h"
-
-/***********************************************************************************************************************
-Macro definitions (Register bit)
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Macro definitions
-***********************************************************************************************************************/
-#ifndef __TYPEDEF__
-#define DI      __DI
-#define EI      __EI
-#define HALT    __halt
-#define NOP     __nop
-#define STOP    __stop
-#define BRK     __brk
-
-/* Status list definition */
-#define MD_STATUSBASE       (0x00U)
-#define MD_OK               (MD_STATUSBASE + 0x00U) /* register setting OK */
-#define MD_SPT              (MD_STATUSBASE + 0x01U) /* IIC stop */
-#define MD_NACK             (MD_STATUSBASE + 0x02U) /* IIC no ACK */
-#define MD_BUSY1            (MD_STATUSBASE + 0x03U) /* busy 1 */
-#define MD_BUSY2            (MD_STATUSBASE + 0x04U) /* busy 2 */
-#define MD_OVERRUN           (MD_STATUSBASE + 0x05U) /* IIC OVERRUN occur */
-
-/* Error list definition */
-#define MD_ERRORBASE        (0x80U)
-#define MD_ERROR            (MD_ERRORBASE + 0x00U)  /* error */
-#define MD_ARGERROR         (MD_ERRORBASE + 0x01U)  /* error agrument input error */
-#define MD_ERROR1           (MD_ERRORBASE + 0x02U)  /* error 1 */
-#define MD_ERROR2           (MD_ERRORBASE + 0x03U)  /* error 2 */
-#define MD_ERROR3           (MD_ERRORBASE + 0x04U)  /* error 3 */
-#define MD_ERROR4           (MD_ERRORBASE + 0x05U)  /* error 4 */
-#endif
-
-/***********************************************************************************************************************
-Typedef definitions
-***********************************************************************************************************************/
-#ifndef __TYPEDEF__
-typedef signed char         int8_t;
-typedef unsigned char       uint8_t;
-typedef signed short        int16_t;
-typedef unsigned short      uint16_t;
-typedef signed long         int32_t;
-typedef unsigned long       uint32_t;
-typedef unsigned short      MD_STATUS;
-#define __TYPEDEF__
-#endif
-
-/***********************************************************************************************************************
-Global functions
-***********************************************************************************************************************/
-
-#endif
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_macrodriver.h
+* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
+* Device(s)    : R5F104ML
+* Tool-Chain   : CCRL
+* Description  : This file implements general head file.
+* Creation Date: 2/17/2023
+***********************************************************************************************************************/
+
+#ifndef STATUS_H
+#define STATUS_H
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "iodefine.h"
+
+/***********************************************************************************************************************
+Macro definitions (Register bit)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#ifndef __TYPEDEF__
+#define DI      __DI
+#define EI      __EI
+#define HALT    __halt
+#define NOP     __nop
+#define STOP    __stop
+#define BRK     __brk
+
+/* Status list definition */
+#define MD_STATUSBASE       (0x00U)
+#define MD_OK               (MD_STATUSBASE + 0x00U) /* register setting OK */
+#define MD_SPT              (MD_STATUSBASE + 0x01U) /* IIC stop */
+#define MD_NACK             (MD_STATUSBASE + 0x02U) /* IIC no ACK */
+#define MD_BUSY1            (MD_STATUSBASE + 0x03U) /* busy 1 */
+#define MD_BUSY2            (MD_STATUSBASE + 0x04U) /* busy 2 */
+#define MD_OVERRUN           (MD_STATUSBASE + 0x05U) /* IIC OVERRUN occur */
+
+/* Error list definition */
+#define MD_ERRORBASE        (0x80U)
+#define MD_ERROR            (MD_ERRORBASE + 0x00U)  /* error */
+#define MD_ARGERROR         (MD_ERRORBASE + 0x01U)  /* error agrument input error */
+#define MD_ERROR1           (MD_ERRORBASE + 0x02U)  /* error 1 */
+#define MD_ERROR2           (MD_ERRORBASE + 0x03U)  /* error 2 */
+#define MD_ERROR3           (MD_ERRORBASE + 0x04U)  /* error 3 */
+#define MD_ERROR4           (MD_ERRORBASE + 0x05U)  /* error 4 */
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+#ifndef __TYPEDEF__
+typedef signed char         int8_t;
+typedef unsigned char       uint8_t;
+typedef signed short        int16_t;
+typedef unsigned short      uint16_t;
+typedef signed long         int32_t;
+typedef unsigned long       uint32_t;
+typedef unsigned short      MD_STATUS;
+#define __TYPEDEF__
+#endif
+
+/***********************************************************************************************************************
+Global functions
+***********************************************************************************************************************/
+
+#endif
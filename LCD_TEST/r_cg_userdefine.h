@@ -1,56 +1,109 @@
-/***********************************************************************************************************************
-* DISCLAIMER
-* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
-* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
-* applicable laws, including copyright laws. 
-* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
-* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
-* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
-* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
-* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
-* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
-* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
-* following link:
-* http://www.renesas.com/disclaimer
-*
-* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-* File Name    : r_cg_userdefine.h
-* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
-* Device(s)    : R5F104ML
-* Tool-Chain   : CCRL
-* Description  : This file includes user definition.
-* Creation Date: 2/17/2023
-***********************************************************************************************************************/
-
-#ifndef _USER_DEF_H
-#define _USER_DEF_H
-
-/***********************************************************************************************************************
-User definitions
-***********************************************************************************************************************/
-
-/* Start user code for function. Do not edit comment generated here */
-
-
-#define REG_SELECT  		P1_bit.no4
-#define ENABLE      		P1_bit.no5
-#define DATA_PIN4   		P1_bit.no0
-#define DATA_PIN5   		P1_bit.no1
-#define DATA_PIN6   		P1_bit.no2
-#define DATA_PIN7   		P1_bit.no3
-#define READ_DATA   		P11_bit.no0
-
-
-#define SET_PIN     		P5_bit.no2
-#define USER_LED    		P4_bit.no3
-
-
-void Delay_Ms(uint16_t Cnt);
-void Delay_Us(uint16_t Cnt);
-
-/* End user code. Do not edit comment generated here */
-#endif
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_userdefine.h
+* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
+* Device(s)    : R5F104ML
+* Tool-Chain   : CCRL
+* Description  : This file includes user definition.
+* Creation Date: 2/17/2023
+***********************************************************************************************************************/
+
+#ifndef _USER_DEF_H
+#define _USER_DEF_H
+
+/***********************************************************************************************************************
+User definitions
+***********************************************************************************************************************/
+
+/* Start user code for function. Do not edit comment generated here */
+
+
+/* LCD data lines as port number / bit number pairs */
+#define LCD_D4_PORT 		1
+#define LCD_D4_BIT  		0
+#define LCD_D5_PORT 		1
+#define LCD_D5_BIT  		1
+#define LCD_D6_PORT 		1
+#define LCD_D6_BIT  		2
+#define LCD_D7_PORT 		1
+#define LCD_D7_BIT  		3
+
+#define LCD_PORT_(port)     	P##port
+#define LCD_PORT(port)      	LCD_PORT_(port)
+#define LCD_PIN_(port, bit) 	P##port##_bit.no##bit
+#define LCD_PIN(port, bit)  	LCD_PIN_(port, bit)
+
+#define REG_SELECT  		P1_bit.no4
+#define ENABLE      		P1_bit.no5
+#define DATA_PIN4   		LCD_PIN(LCD_D4_PORT, LCD_D4_BIT)
+#define DATA_PIN5   		LCD_PIN(LCD_D5_PORT, LCD_D5_BIT)
+#define DATA_PIN6   		LCD_PIN(LCD_D6_PORT, LCD_D6_BIT)
+#define DATA_PIN7   		LCD_PIN(LCD_D7_PORT, LCD_D7_BIT)
+#define READ_DATA   		P11_bit.no0
+
+/* D4..D7 on four ascending bits of one port: send_to_lcd() updates the nibble
+ * with one masked port write instead of four bit read-modify-writes */
+#if (LCD_D5_PORT == LCD_D4_PORT) && (LCD_D6_PORT == LCD_D4_PORT) && (LCD_D7_PORT == LCD_D4_PORT) && \
+    (LCD_D5_BIT == (LCD_D4_BIT + 1)) && (LCD_D6_BIT == (LCD_D4_BIT + 2)) && (LCD_D7_BIT == (LCD_D4_BIT + 3))
+#define LCD_NIBBLE_PORT     	LCD_PORT(LCD_D4_PORT)
+#define LCD_NIBBLE_SHIFT    	LCD_D4_BIT
+#define LCD_NIBBLE_MASK     	((uint8_t)(0x0FU << LCD_NIBBLE_SHIFT))
+#endif
+
+
+#define SET_PIN     		P5_bit.no2
+#define USER_LED    		P4_bit.no3
+
+
+/* Low power idle
+ * Delay_Ms() enters STOP (woken by the interval timer on fSUB) when the wait is
+ * at least IDLE_STOP_MIN_MS, otherwise HALT (woken by the TAU0 tick interrupts).
+ * Set IDLE_USE_STOP to 0 to keep fIH running and only ever use HALT. */
+#define IDLE_USE_STOP       		1
+#define IDLE_STOP_MIN_MS    		20U
+#define IDLE_STOP_MAX_MS    		125U    /* 4096 counts of fSUB, the 12-bit ITMC limit */
+
+typedef struct {
+    volatile uint32_t	activeMs;       /* ms ticks counted while the CPU was running   */
+    volatile uint32_t	haltMs;         /* ms ticks counted while the CPU was in HALT   */
+    volatile uint32_t	stopMs;         /* ms spent in STOP, credited from the IT period */
+    volatile uint32_t	haltCount;      /* HALT entries                                  */
+    volatile uint16_t	stopCount;      /* STOP entries                                  */
+    volatile uint16_t	stopEarlyWake;  /* STOP left by an interrupt other than INTIT    */
+    volatile uint16_t	wakeLatency;    /* last tick-to-thread latency in fCLK clocks    */
+    volatile uint16_t	wakeLatencyMax; /* worst tick-to-thread latency in fCLK clocks   */
+    volatile uint8_t	inHalt;         /* set while the CPU sits in HALT                */
+    volatile uint8_t	itExpired;      /* set by INTIT when the STOP period elapsed     */
+} Idle_Stats_S;
+
+extern Idle_Stats_S IdleStats;
+
+/* Set to 1 to show the lcd_printf() cost on the display after lcd_init():
+ * row 0 - fCLK cycles to format one field (bus excluded), row 1 - us to write it */
+#define LCD_FMT_BENCHMARK   		0
+
+void Delay_Ms(uint16_t Cnt);
+void Delay_Us(uint16_t Cnt);
+void Idle_Hook(volatile uint16_t *Pending);
+uint16_t Idle_Stop(uint16_t Ms);
+
+/* End user code. Do not edit comment generated here */
+#endif
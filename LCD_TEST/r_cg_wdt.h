@@ -1,52 +1,88 @@
-/***********************************************************************************************************************
-* DISCLAIMER
-* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
-* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
-* applicable laws, including copyright laws. 
-* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
-* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
-* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
-* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
-* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
-* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
-* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
-* following link:
-* http://www.renesas.com/disclaimer
-*
-* Copyright (C) 2011, 2021 Renesas Electronics Corporation. All rights reserved.
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-* File Name    : r_cg_wdt.h
-* Version      : CodeGenerator for RL78/G14 V2.05.06.02 [08 Nov 2021]
-* Device(s)    : R5F104ML
-* Tool-Chain   : CCRL
-* Description  : This file implements device driver for WDT module.
-* Creation Date: 07-02-2023
-***********************************************************************************************************************/
-
-#ifndef WDT_H
-#define WDT_H
-
-/***********************************************************************************************************************
-Macro definitions (Register bit)
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Macro definitions
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Typedef definitions
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Global functions
-***********************************************************************************************************************/
-void R_WDT_Create(void);
-void R_WDT_Restart(void);
-
-/* Start user code for function. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-#endif
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2011, 2021 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_wdt.h
+* Version      : CodeGenerator for RL78/G14 V2.05.06.02 [08 Nov 2021]
+* Device(s)    : R5F104ML
+* Tool-Chain   : CCRL
+* Description  : This file implements device driver for WDT module.
+* Creation Date: 07-02-2023
+***********************************************************************************************************************/
+
+#ifndef WDT_H
+#define WDT_H
+
+/***********************************************************************************************************************
+Macro definitions (Register bit)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Global functions
+***********************************************************************************************************************/
+void R_WDT_Create(void);
+void R_WDT_Restart(void);
+
+/* Start user code for function. Do not edit comment generated here */
+
+/* Task supervisor
+ * INTWDTI comes at 75% of the overflow time (2^16 / fIL, option byte 000C0H). The WDT is
+ * restarted there only if every registered task checked in since the previous INTWDTI;
+ * otherwise the late tasks are recorded and the WDT is left to overflow and reset. */
+#define WDG_TASK_MAIN       		0U      /* main loop pass                           */
+#define WDG_TASK_TICK       		1U      /* 1 ms tick, or a completed STOP period    */
+#define WDG_TASKS           		2U
+
+#define WDG_RECORD_MAGIC    		0x5744U
+#define WDG_RESF_TRAP       		0x80U   /* illegal instruction                      */
+#define WDG_RESF_WDTRF      		0x10U   /* watchdog overflow or bad WDTE write      */
+#define WDG_RESF_RPERF      		0x04U   /* RAM parity error                         */
+#define WDG_RESF_IAWRF      		0x02U   /* illegal memory access                    */
+#define WDG_RESF_LVIRF      		0x01U   /* low voltage detector                     */
+
+/* Kept in a section cstart does not clear, so it survives every reset but power-on.
+ * WdgNoInit_n is placed at the base of RAM by -start (LCD_TEST.mtpj), the rest of
+ * RAM is laid out around it by -AUTO_SECTION_LAYOUT.
+ * Known limit: a power loss clears it, so the reason for a WDT reset followed by a
+ * power cycle is lost. Keeping it needs the data flash, and writing that needs the
+ * Renesas data flash library (FDL), which this project does not link. */
+typedef struct {
+    uint16_t	magic;
+    uint16_t	resets;         /* WDT resets since the record was created       */
+    uint8_t	resf;           /* RESF read by R_CGC_Get_ResetSource()          */
+    uint8_t	lateMask;       /* tasks silent when the WDT was let overflow    */
+} Wdg_Record_S;
+
+extern Wdg_Record_S WdgLast;    /* the record as the previous run left it        */
+
+void Wdg_SaveResetSource(uint8_t Resf);
+void Wdg_Init(void);
+void Wdg_Register(uint8_t Task);
+void Wdg_CheckIn(uint8_t Task);
+
+/* End user code. Do not edit comment generated here */
+#endif
@@ -1,64 +1,168 @@
-/***********************************************************************************************************************
-* DISCLAIMER
-* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
-* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
-* applicable laws, including copyright laws. 
-* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
-* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
-* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
-* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
-* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
-* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
-* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
-* following link:
-* http://www.renesas.com/disclaimer
-*
-* Copyright (C) 2011, 2021 Renesas Electronics Corporation. All rights reserved.
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-* File Name    : r_cg_wdt_user.c
-* Version      : CodeGenerator for RL78/G14 V2.05.06.02 [08 Nov 2021]
-* Device(s)    : R5F104ML
-* Tool-Chain   : CCRL
-* Description  : This file implements device driver for WDT module.
-* Creation Date: 07-02-2023
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Includes
-***********************************************************************************************************************/
-#include "r_cg_macrodriver.h"
-#include "r_cg_wdt.h"
-/* Start user code for include. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-#include "r_cg_userdefine.h"
-
-/***********************************************************************************************************************
-Pragma directive
-***********************************************************************************************************************/
-#pragma interrupt r_wdt_interrupt(vect=INTWDTI)
-/* Start user code for pragma. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-
-/***********************************************************************************************************************
-Global variables and functions
-***********************************************************************************************************************/
-/* Start user code for global. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-
-/***********************************************************************************************************************
-* Function Name: r_wdt_interrupt
-* Description  : This function is INTWDTI interrupt service routine.
-* Arguments    : None
-* Return Value : None
-***********************************************************************************************************************/
-static void __near r_wdt_interrupt(void)
-{
-    /* Start user code. Do not edit comment generated here */
-    /* End user code. Do not edit comment generated here */
-}
-
-/* Start user code for adding. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2011, 2021 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_wdt_user.c
+* Version      : CodeGenerator for RL78/G14 V2.05.06.02 [08 Nov 2021]
+* Device(s)    : R5F104ML
+* Tool-Chain   : CCRL
+* Description  : This file implements device driver for WDT module.
+* Creation Date: 07-02-2023
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "r_cg_wdt.h"
+/* Start user code for include. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+#pragma interrupt r_wdt_interrupt(vect=INTWDTI)
+/* Start user code for pragma. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+
+#pragma section bss WdgNoInit
+Wdg_Record_S WdgRecord;
+#pragma section
+
+Wdg_Record_S WdgLast;
+
+static uint8_t WdgTasks = 0U;                   /* registered tasks, one bit each   */
+static volatile uint8_t WdgAlive[WDG_TASKS];    /* byte stores: no read-modify-write
+                                                   shared with the interrupts       */
+
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: r_wdt_interrupt
+* Description  : This function is INTWDTI interrupt service routine.
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+static void __near r_wdt_interrupt(void)
+{
+    /* Start user code. Do not edit comment generated here */
+    uint8_t task;
+    uint8_t late = 0U;
+
+    for (task = 0U; task < WDG_TASKS; task++)
+    {
+        if ((((WdgTasks >> task) & 1U) != 0U) && (WdgAlive[task] == 0U))
+        {
+            late |= (uint8_t)(1U << task);
+        }
+        WdgAlive[task] = 0U;
+    }
+
+    if (late == 0U)
+    {
+        R_WDT_Restart();
+    }
+    else
+    {
+        /* No restart: the WDT overflows within the last 25% of its period */
+        WdgRecord.lateMask = late;
+    }
+    /* End user code. Do not edit comment generated here */
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: Wdg_SaveResetSource
+* Description  : This function updates the no-init record with the reset source. It is called from
+*                R_CGC_Get_ResetSource(), before cstart clears .bss, so it touches nothing but the record.
+* Arguments    : Resf -
+*                    RESF as read at reset
+* Return Value : None
+***********************************************************************************************************************/
+void Wdg_SaveResetSource(uint8_t Resf)
+{
+    /* After power-on the record was never written: do not let its parity reset the chip */
+    RPERDIS = 1U;
+    if (WdgRecord.magic != WDG_RECORD_MAGIC)
+    {
+        WdgRecord.magic = WDG_RECORD_MAGIC;
+        WdgRecord.resets = 0U;
+        WdgRecord.lateMask = 0U;
+    }
+    RPEF = 0U;
+    RPERDIS = 0U;
+
+    if ((Resf & WDG_RESF_WDTRF) != 0U)
+    {
+        WdgRecord.resets++;
+    }
+    WdgRecord.resf = Resf;
+}
+
+/***********************************************************************************************************************
+* Function Name: Wdg_Init
+* Description  : This function takes a copy of the record for the application and re-arms it.
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+void Wdg_Init(void)
+{
+    WdgLast = WdgRecord;
+    WdgRecord.lateMask = 0U;
+}
+
+/***********************************************************************************************************************
+* Function Name: Wdg_Register
+* Description  : This function adds a task to the supervisor; it counts as alive until the next INTWDTI.
+* Arguments    : Task -
+*                    WDG_TASK_xxx
+* Return Value : None
+***********************************************************************************************************************/
+void Wdg_Register(uint8_t Task)
+{
+    if (Task < WDG_TASKS)
+    {
+        WdgAlive[Task] = 1U;
+        WdgTasks |= (uint8_t)(1U << Task);
+    }
+}
+
+/***********************************************************************************************************************
+* Function Name: Wdg_CheckIn
+* Description  : This function marks the task alive for the current WDT period.
+* Arguments    : Task -
+*                    WDG_TASK_xxx
+* Return Value : None
+***********************************************************************************************************************/
+void Wdg_CheckIn(uint8_t Task)
+{
+    if (Task < WDG_TASKS)
+    {
+        WdgAlive[Task] = 1U;
+    }
+}
+
+/* End user code. Do not edit comment generated here */
@@ -1,153 +1,349 @@
-/***********************************************************************************************************************
-* DISCLAIMER
-* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
-* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
-* applicable laws, including copyright laws. 
-* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
-* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
-* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
-* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
-* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
-* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
-* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
-* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
-* following link:
-* http://www.renesas.com/disclaimer
-*
-* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-* File Name    : r_main.c
-* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
-* Device(s)    : R5F104ML
-* Tool-Chain   : CCRL
-* Description  : This file implements main function.
-* Creation Date: 2/17/2023
-***********************************************************************************************************************/
-
-/***********************************************************************************************************************
-Includes
-***********************************************************************************************************************/
-#include "r_cg_macrodriver.h"
-#include "r_cg_cgc.h"
-#include "r_cg_port.h"
-#include "r_cg_timer.h"
-/* Start user code for include. Do not edit comment generated here */
-
-#include "LCD1602.h"
-
-/* End user code. Do not edit comment generated here */
-#include "r_cg_userdefine.h"
-
-/***********************************************************************************************************************
-Pragma directive
-***********************************************************************************************************************/
-/* Start user code for pragma. Do not edit comment generated here */
-/* End user code. Do not edit comment generated here */
-
-/***********************************************************************************************************************
-Global variables and functions
-***********************************************************************************************************************/
-/* Start user code for global. Do not edit comment generated here */
-
-volatile uint16_t DelayMsCnt = 0;
-volatile uint16_t DelayUsCnt = 0;
-
-int i=0, row=0, col=0;
-
-/* End user code. Do not edit comment generated here */
-void R_MAIN_UserInit(void);
-
-/***********************************************************************************************************************
-* Function Name: main
-* Description  : This function implements main function.
-* Arguments    : None
-* Return Value : None
-***********************************************************************************************************************/
-void main(void)
-{
-    R_MAIN_UserInit();
-    /* Start user code. Do not edit comment generated here */
-    
-    lcd_clear();
-    lcd_init ();
-    lcd_put_cur(0, 1);
-    lcd_send_string("Hello! ");
-    lcd_send_string("THIS ");
-    lcd_send_string("IS ");
-    
-    lcd_put_cur(1, 2);
-    lcd_send_string("YOGANATHAN :)");
-    Delay_Ms(3000);
-    lcd_clear();
-
-    while (1U)
-    {
-	    
-	  for (i=0;i<128;i++)
-	  {
-		  lcd_put_cur(row, col);
-
-		  lcd_send_data(i+48);
-
-		  col++;
-
-		  if (col > 15) {row++; col = 0;}
-		  if (row > 1) row=0;
-
-		  Delay_Ms(250);
-	  }
-
-    }
-    /* End user code. Do not edit comment generated here */
-}
-
-/***********************************************************************************************************************
-* Function Name: R_MAIN_UserInit
-* Description  : This function adds user code before implementing main function.
-* Arguments    : None
-* Return Value : None
-***********************************************************************************************************************/
-void R_MAIN_UserInit(void)
-{
-    /* Start user code. Do not edit comment generated here */
-    
-    /* Initializing Timers */
-    R_TAU0_Channel0_Start();
-    R_TAU0_Channel1_Start();	
-    
-    EI();
-    /* End user code. Do not edit comment generated here */
-}
-
-/* Start user code for adding. Do not edit comment generated here */
-
-void Delay_Ms(uint16_t Cnt)
-{
-    DelayMsCnt = Cnt;
-    while(1)
-    {
-	  if(DelayMsCnt != 0) {
-	       __nop();
-	  }else {
-	       break;
-	  }
-    }
-}
-
-
-void Delay_Us(uint16_t Cnt)
-{
-    DelayUsCnt = Cnt;
-    while(1)
-    {
-	  if(DelayUsCnt != 0) {
-	       __nop();
-	  }else {
-	       break;
-	  }
-    }
-}
-
-/* End user code. Do not edit comment generated here */
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2011, 2020 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_main.c
+* Version      : CodeGenerator for RL78/G14 V2.05.05.01 [25 Nov 2020]
+* Device(s)    : R5F104ML
+* Tool-Chain   : CCRL
+* Description  : This file implements main function.
+* Creation Date: 2/17/2023
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "r_cg_cgc.h"
+#include "r_cg_port.h"
+#include "r_cg_timer.h"
+#include "r_cg_wdt.h"
+/* Start user code for include. Do not edit comment generated here */
+
+#include "LCD1602.h"
+#include "TsCodec.h"
+
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+/* Start user code for pragma. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+
+volatile uint16_t DelayMsCnt = 0;
+volatile uint16_t DelayUsCnt = 0;
+
+Idle_Stats_S IdleStats = {0};
+
+int i=0, row=0, col=0;
+
+#if LCD_FMT_BENCHMARK
+#define BENCH_FIELDS        100U
+static uint16_t benchChars = 0;
+static void Bench_Sink(char c);
+static void LCD_FmtBenchmark(void);
+#endif
+
+#if TSC_BENCH
+#define TSC_BENCH_SAMPLES   3600U
+#define TSC_BENCH_FRAME     200U
+static uint8_t tscFrame[TSC_BENCH_FRAME];
+static void Tsc_Benchmark(void);
+#endif
+
+#if LCD_FMT_BENCHMARK || TSC_BENCH
+static uint32_t Bench_Now(void);
+#endif
+
+/* End user code. Do not edit comment generated here */
+void R_MAIN_UserInit(void);
+
+/***********************************************************************************************************************
+* Function Name: main
+* Description  : This function implements main function.
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+void main(void)
+{
+    R_MAIN_UserInit();
+    /* Start user code. Do not edit comment generated here */
+    
+    lcd_clear();
+    lcd_init ();
+
+#if LCD_FMT_BENCHMARK
+    LCD_FmtBenchmark();
+#endif
+#if TSC_BENCH
+    Tsc_Benchmark();
+#endif
+
+    lcd_put_cur(0, 1);
+    lcd_send_string("Hello! ");
+    lcd_send_string("THIS ");
+    lcd_send_string("IS ");
+    
+    lcd_put_cur(1, 2);
+    lcd_send_string("YOGANATHAN :)");
+    Wdg_CheckIn(WDG_TASK_MAIN);     /* the first INTWDTI is >= 2.85 s after reset */
+    Delay_Ms(3000);
+    lcd_clear();
+
+    /* Last reset was the watchdog: count and the tasks that stopped it being restarted */
+    if ((WdgLast.resf & WDG_RESF_WDTRF) != 0U)
+    {
+	  lcd_printf(0, 0, "WDT reset %5u", WdgLast.resets);
+	  lcd_printf(1, 0, "late %u RESF %3u", WdgLast.lateMask, WdgLast.resf);
+	  Wdg_CheckIn(WDG_TASK_MAIN);
+	  Delay_Ms(2000);
+	  lcd_clear();
+    }
+
+    while (1U)
+    {
+	    
+	  for (i=0;i<128;i++)
+	  {
+		  Wdg_CheckIn(WDG_TASK_MAIN);
+
+		  lcd_put_cur(row, col);
+
+		  lcd_send_data(i+48);
+
+		  col++;
+
+		  if (col > 15) {row++; col = 0;}
+		  if (row > 1) row=0;
+
+		  Delay_Ms(250);
+	  }
+
+    }
+    /* End user code. Do not edit comment generated here */
+}
+
+/***********************************************************************************************************************
+* Function Name: R_MAIN_UserInit
+* Description  : This function adds user code before implementing main function.
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+void R_MAIN_UserInit(void)
+{
+    /* Start user code. Do not edit comment generated here */
+    
+    /* Initializing Timers */
+    R_TAU0_Channel0_Start();
+    R_TAU0_Channel1_Start();	
+
+    /* WDT supervisor (R_WDT_Create() in R_Systeminit()) */
+    Wdg_Init();
+    Wdg_Register(WDG_TASK_MAIN);
+    Wdg_Register(WDG_TASK_TICK);
+    
+    EI();
+    /* End user code. Do not edit comment generated here */
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+
+void Delay_Ms(uint16_t Cnt)
+{
+    uint16_t slept;
+
+    DelayMsCnt = Cnt;
+
+#if IDLE_USE_STOP
+    /* Long waits: stop fIH altogether and let the interval timer wake us */
+    while(DelayMsCnt >= IDLE_STOP_MIN_MS)
+    {
+	  slept = Idle_Stop(DelayMsCnt);
+	  if(slept != 0U) {
+	       DI();
+	       DelayMsCnt = (DelayMsCnt > slept) ? (DelayMsCnt - slept) : 0U;
+	       EI();
+	  }else {
+	       /* Released early by another interrupt, wait one tick before retrying */
+	       Idle_Hook(&DelayMsCnt);
+	  }
+    }
+#endif
+
+    while(DelayMsCnt != 0)
+    {
+	  Idle_Hook(&DelayMsCnt);
+    }
+}
+
+
+void Delay_Us(uint16_t Cnt)
+{
+    DelayUsCnt = Cnt;
+    while(DelayUsCnt != 0)
+    {
+	  Idle_Hook(&DelayUsCnt);
+    }
+}
+
+
+/*
+ * Idle_Hook - HALT the CPU until the next interrupt while Pending is non-zero.
+ * Interrupts are disabled around the check so a tick landing between the test and
+ * the HALT instruction releases HALT at once instead of being slept through.
+ * When the 1 ms tick is the wake source, TDR00 - TCR00 gives the clocks elapsed
+ * since the tick, i.e. the wake latency seen by the thread including the ISR.
+ */
+void Idle_Hook(volatile uint16_t *Pending)
+{
+    uint16_t latency;
+
+    DI();
+    if(*Pending == 0) {
+	  EI();
+	  return;
+    }
+    IdleStats.haltCount++;
+    IdleStats.inHalt = 1U;
+    HALT();
+    EI();
+    NOP();
+
+    /* INTTM00 clears inHalt when it is the wake source */
+    if(IdleStats.inHalt == 0U) {
+	  latency = TDR00 - TCR00;
+	  IdleStats.wakeLatency = latency;
+	  if(latency > IdleStats.wakeLatencyMax) {
+	       IdleStats.wakeLatencyMax = latency;
+	  }
+    }
+    IdleStats.inHalt = 0U;
+}
+
+#if LCD_FMT_BENCHMARK || TSC_BENCH
+/* fCLK clocks since the timers started, from the 1 ms tick and TCR00.
+ * Ticks are split between activeMs and haltMs, so both are summed. */
+static uint32_t Bench_Now(void)
+{
+    uint32_t ms;
+    uint16_t elapsed;
+
+    do {
+	  ms = IdleStats.activeMs + IdleStats.haltMs;
+	  elapsed = TDR00 - TCR00;
+    } while(ms != (IdleStats.activeMs + IdleStats.haltMs));
+
+    return (ms * ((uint32_t)TDR00 + 1UL)) + elapsed;
+}
+#endif
+
+#if LCD_FMT_BENCHMARK
+/* Sink that only counts, so the formatter is timed without the LCD bus */
+static void Bench_Sink(char c)
+{
+    (void)c;
+    benchChars++;
+}
+
+static void LCD_FmtBenchmark(void)
+{
+    uint32_t start, fmtCycles, busCycles;
+    uint16_t n;
+
+    start = Bench_Now();
+    for(n = 0; n < BENCH_FIELDS; n++)
+    {
+	  lcd_format(Bench_Sink, "%5.1fV %4uHz", 2305, 50);
+    }
+    fmtCycles = (Bench_Now() - start) / BENCH_FIELDS;
+
+    start = Bench_Now();
+    lcd_printf(1, 0, "%5.1fV %4uHz", 2305, 50);
+    busCycles = Bench_Now() - start;
+
+    lcd_printf(0, 0, "fmt%6lu cy/fld", fmtCycles);
+    lcd_printf(1, 0, "bus%6lu us/fld", busCycles / ((TDR00 + 1UL) / 1000UL));
+    /* Two halves, each shorter than the INTWDTI period */
+    Wdg_CheckIn(WDG_TASK_MAIN);
+    Delay_Ms(2500);
+    Wdg_CheckIn(WDG_TASK_MAIN);
+    Delay_Ms(2500);
+    lcd_clear();
+}
+#endif
+
+#if TSC_BENCH
+/* TsCodec (Common/Telemetry/src) on the RL78: an hour of 1 s metering readings
+ * (V in mV, mA, W, Ws, a steady load with meter noise), the same trace as the
+ * RF433 receiver's TSC_BENCH build. Row 0 - fCLK cycles per Tsc_Put(), frame
+ * change included, the 1 ms tick is not masked; row 1 - frame bytes and raw bytes. */
+static void Tsc_Benchmark(void)
+{
+    Handle_Tsc_S tsc;
+    int32_t v[4] = { 230000L, 520L, 120L, 0L };
+    uint32_t rng = 1UL, t = 0UL, start, overhead, cyc, sum = 0UL, bytes = 0UL;
+    uint16_t n;
+
+    start = Bench_Now();
+    overhead = Bench_Now() - start;
+
+    Tsc_Begin(&tsc, tscFrame, sizeof(tscFrame), 4U, 0x08U);
+    for(n = 0; n < TSC_BENCH_SAMPLES; n++)
+    {
+	  rng  = (rng * 1664525UL) + 1013904223UL;
+	  t   += 1000UL;
+	  v[0] = 230000L + (int32_t)((rng >> 24) & 0x3FUL) - 32L;
+	  v[1] = 520L + (int32_t)((rng >> 16) & 0x07UL) - 4L;
+	  v[2] = ((v[0] / 1000L) * v[1]) / 1000L;
+	  v[3] += v[2];
+
+	  start = Bench_Now();
+	  if(!Tsc_Put(&tsc, t, v)) {
+	       bytes += Tsc_End(&tsc);
+	       Tsc_Begin(&tsc, tscFrame, sizeof(tscFrame), 4U, 0x08U);
+	       Tsc_Put(&tsc, t, v);
+	  }
+	  cyc  = Bench_Now() - start;
+	  sum += (cyc > overhead) ? (cyc - overhead) : 0UL;
+
+	  if((n & 0xFFU) == 0U) {
+	       Wdg_CheckIn(WDG_TASK_MAIN);
+	  }
+    }
+    bytes += Tsc_End(&tsc);
+
+    lcd_printf(0, 0, "tsc%6lu cy/smp", sum / TSC_BENCH_SAMPLES);
+    lcd_printf(1, 0, "%6lu/%6lu B", bytes, (uint32_t)TSC_BENCH_SAMPLES * TSC_RAW_LEN(4UL));
+    /* Two halves, each shorter than the INTWDTI period */
+    Wdg_CheckIn(WDG_TASK_MAIN);
+    Delay_Ms(2500);
+    Wdg_CheckIn(WDG_TASK_MAIN);
+    Delay_Ms(2500);
+    lcd_clear();
+}
+#endif
+
+/* End user code. Do not edit comment generated here */
@@ -1,344 +1,626 @@
-/* USER CODE BEGIN Header */
-/**
-  ******************************************************************************
-  * @file           : main.c
-  * @brief          : Main program body
-  ******************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2023 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  ******************************************************************************
-  */
-/* USER CODE END Header */
-/* Includes ------------------------------------------------------------------*/
-#include "main.h"
-
-/* Private includes ----------------------------------------------------------*/
-/* USER CODE BEGIN Includes */
-#include "stdio.h"
-#include "RH_ASK.h"
-
-/* USER CODE END Includes */
-
-/* Private typedef -----------------------------------------------------------*/
-/* USER CODE BEGIN PTD */
-
-/* USER CODE END PTD */
-
-/* Private define ------------------------------------------------------------*/
-/* USER CODE BEGIN PD */
-/* USER CODE END PD */
-
-/* Private macro -------------------------------------------------------------*/
-/* USER CODE BEGIN PM */
-
-/* USER CODE END PM */
-
-/* Private variables ---------------------------------------------------------*/
-TIM_HandleTypeDef htim2;
-
-UART_HandleTypeDef huart2;
-
-/* USER CODE BEGIN PV */
-
-volatile uint32_t g_timerCount = 0;
-
-uint32_t Count = 0;
-uint8_t len=0, aMsgBuf[50] = {0};
-
-uint8_t buf[RH_ASK_MAX_MESSAGE_LEN] = {0};
-uint8_t buflen = 0;
-
-/* USER CODE END PV */
-
-/* Private function prototypes -----------------------------------------------*/
-void SystemClock_Config(void);
-static void MX_GPIO_Init(void);
-static void MX_USART2_UART_Init(void);
-static void MX_TIM2_Init(void);
-/* USER CODE BEGIN PFP */
-
-/* USER CODE END PFP */
-
-/* Private user code ---------------------------------------------------------*/
-/* USER CODE BEGIN 0 */
-
-/* USER CODE END 0 */
-
-/**
-  * @brief  The application entry point.
-  * @retval int
-  */
-int main(void)
-{
-  /* USER CODE BEGIN 1 */
-
-  /* USER CODE END 1 */
-
-  /* MCU Configuration--------------------------------------------------------*/
-
-  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
-  HAL_Init();
-
-  /* USER CODE BEGIN Init */
-
-  /* USER CODE END Init */
-
-  /* Configure the system clock */
-  SystemClock_Config();
-
-  /* USER CODE BEGIN SysInit */
-
-  /* USER CODE END SysInit */
-
-  /* Initialize all configured peripherals */
-  MX_GPIO_Init();
-  MX_USART2_UART_Init();
-  MX_TIM2_Init();
-  /* USER CODE BEGIN 2 */
-
-  HAL_UART_Transmit(&huart2, (uint8_t *)"/--------------------------------------------------------------/\r", 65, 1000);
-  HAL_UART_Transmit(&huart2, (uint8_t *)"               RF 433Mhz Receiver Test Application              \r", 65, 1000);
-  HAL_UART_Transmit(&huart2, (uint8_t *)"/--------------------------------------------------------------/\r", 65, 1000);
-
-  RH_ASK_Initialization();
-
-  /* USER CODE END 2 */
-
-  /* Infinite loop */
-  /* USER CODE BEGIN WHILE */
-  while (1)
-  {
-    /* USER CODE END WHILE */
-
-    /* USER CODE BEGIN 3 */
-
-	  RH_send((uint8_t *)"Hello World\n", 12);
-	  HAL_Delay(2000);
-
-//	  buflen = RH_ASK_MAX_MESSAGE_LEN;
-//	  if(RH_recv(buf, &buflen) == True) {
-//
-//		  HAL_UART_Transmit(&huart2, (uint8_t *)"rxBuf :", 7, 1000);
-//		  HAL_UART_Transmit(&huart2, (uint8_t *)buf, buflen, 1000);
-//	  }
-//	  HAL_Delay(1);
-  }
-
-  /* USER CODE END 3 */
-}
-
-/**
-  * @brief System Clock Configuration
-  * @retval None
-  */
-void SystemClock_Config(void)
-{
-  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
-  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
-  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
-
-  /** Configure the main internal regulator output voltage
-  */
-  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
-  /** Initializes the RCC Oscillators according to the specified parameters
-  * in the RCC_OscInitTypeDef structure.
-  */
-  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
-  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
-  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
-  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
-  RCC_OscInitStruct.PLL.PLLMUL = RCC_PLLMUL_3;
-  RCC_OscInitStruct.PLL.PLLDIV = RCC_PLLDIV_3;
-  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  /** Initializes the CPU, AHB and APB buses clocks
-  */
-  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
-                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
-  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
-  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
-
-  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART2;
-  PeriphClkInit.Usart2ClockSelection = RCC_USART2CLKSOURCE_PCLK1;
-  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
-  {
-    Error_Handler();
-  }
-}
-
-/**
-  * @brief TIM2 Initialization Function
-  * @param None
-  * @retval None
-  */
-static void MX_TIM2_Init(void)
-{
-
-  /* USER CODE BEGIN TIM2_Init 0 */
-
-  /* USER CODE END TIM2_Init 0 */
-
-  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
-  TIM_MasterConfigTypeDef sMasterConfig = {0};
-
-  /* USER CODE BEGIN TIM2_Init 1 */
-
-  /* USER CODE END TIM2_Init 1 */
-  htim2.Instance = TIM2;
-  htim2.Init.Prescaler = 500;
-  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim2.Init.Period = 1;
-  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-  htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
-  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
-  if (HAL_TIM_ConfigClockSource(&htim2, &sClockSourceConfig) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
-  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
-  if (HAL_TIMEx_MasterConfigSynchronization(&htim2, &sMasterConfig) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  /* USER CODE BEGIN TIM2_Init 2 */
-
-  HAL_TIM_Base_Start_IT(&htim2);
-
-  /* USER CODE END TIM2_Init 2 */
-
-}
-
-/**
-  * @brief USART2 Initialization Function
-  * @param None
-  * @retval None
-  */
-static void MX_USART2_UART_Init(void)
-{
-
-  /* USER CODE BEGIN USART2_Init 0 */
-
-  /* USER CODE END USART2_Init 0 */
-
-  /* USER CODE BEGIN USART2_Init 1 */
-
-  /* USER CODE END USART2_Init 1 */
-  huart2.Instance = USART2;
-  huart2.Init.BaudRate = 115200;
-  huart2.Init.WordLength = UART_WORDLENGTH_8B;
-  huart2.Init.StopBits = UART_STOPBITS_1;
-  huart2.Init.Parity = UART_PARITY_NONE;
-  huart2.Init.Mode = UART_MODE_TX_RX;
-  huart2.Init.HwFlowCtl = UART_HWCONTROL_NONE;
-  huart2.Init.OverSampling = UART_OVERSAMPLING_16;
-  huart2.Init.OneBitSampling = UART_ONE_BIT_SAMPLE_DISABLE;
-  huart2.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
-  if (HAL_UART_Init(&huart2) != HAL_OK)
-  {
-    Error_Handler();
-  }
-  /* USER CODE BEGIN USART2_Init 2 */
-
-  /* USER CODE END USART2_Init 2 */
-
-}
-
-/**
-  * @brief GPIO Initialization Function
-  * @param None
-  * @retval None
-  */
-static void MX_GPIO_Init(void)
-{
-  GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-  /* GPIO Ports Clock Enable */
-  __HAL_RCC_GPIOC_CLK_ENABLE();
-  __HAL_RCC_GPIOA_CLK_ENABLE();
-
-  /*Configure GPIO pin Output Level */
-  HAL_GPIO_WritePin(GPIOA, RH_TX_Pin|LED_Pin, GPIO_PIN_RESET);
-
-  /*Configure GPIO pins : RH_TX_Pin LED_Pin */
-  GPIO_InitStruct.Pin = RH_TX_Pin|LED_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
-  GPIO_InitStruct.Pull = GPIO_NOPULL;
-  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
-  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-
-  /*Configure GPIO pin : RH_RX_Pin */
-  GPIO_InitStruct.Pin = RH_RX_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
-  GPIO_InitStruct.Pull = GPIO_NOPULL;
-  HAL_GPIO_Init(RH_RX_GPIO_Port, &GPIO_InitStruct);
-
-}
-
-/* USER CODE BEGIN 4 */
-
-/**
-  * @brief  Period elapsed callback in non-blocking mode
-  * @param  htim TIM handle
-  * @retval None
-  */
-void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
-{
-	RH_HandleTimerInterrupt_16KHz();
-//	g_timerCount++;
-}
-
-/* USER CODE END 4 */
-
-/**
-  * @brief  This function is executed in case of error occurrence.
-  * @retval None
-  */
-void Error_Handler(void)
-{
-  /* USER CODE BEGIN Error_Handler_Debug */
-  /* User can add his own implementation to report the HAL error return state */
-  __disable_irq();
-  while (1)
-  {
-  }
-  /* USER CODE END Error_Handler_Debug */
-}
-
-#ifdef  USE_FULL_ASSERT
-/**
-  * @brief  Reports the name of the source file and the source line number
-  *         where the assert_param error has occurred.
-  * @param  file: pointer to the source file name
-  * @param  line: assert_param error line source number
-  * @retval None
-  */
-void assert_failed(uint8_t *file, uint32_t line)
-{
-  /* USER CODE BEGIN 6 */
-  /* User can add his own implementation to report the file name and line number,
-     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
-  /* USER CODE END 6 */
-}
-#endif /* USE_FULL_ASSERT */
-
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : main.c
+  * @brief          : Main program body
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* USER CODE BEGIN Includes */
+#include "stdio.h"
+#include "RH_ASK.h"
+#include "Clock_Profile.h"
+#include "Console.h"
+#include "RF_Trace.h"
+#include "Telemetry.h"
+#include "RF_Pool.h"
+#include "Ram_Usage.h"
+#include "RF_Log.h"
+#include "TsCodec.h"
+#include "Watchdog.h"
+#include "Fault.h"
+#include "RF_Bulk.h"
+#include "RF_ResetLog.h"
+
+/* USER CODE END Includes */
+
+/* Private typedef -----------------------------------------------------------*/
+/* USER CODE BEGIN PTD */
+
+/* USER CODE END PTD */
+
+/* Private define ------------------------------------------------------------*/
+/* USER CODE BEGIN PD */
+#define APP_TLM_STATUS_MAX 		TLM_ENCODED_MAX(TLM_HEADER_LEN + 72U + TLM_CRC_LEN)
+#define APP_TLM_RX_MAX 			TLM_ENCODED_MAX(TLM_HEADER_LEN + 2U + RH_ASK_MAX_MESSAGE_LEN + TLM_CRC_LEN)
+#define APP_TSC_BENCH_SAMPLES 	3600U
+#define APP_TSC_BENCH_FRAME 	200U
+#define APP_WDG_LOOP_MS 		5000U		/* loop pass, HAL_Delay(2000) included */
+#define APP_WDG_LOG_MS 			30000U		/* flash log queue stuck full		*/
+/* USER CODE END PD */
+
+/* Private macro -------------------------------------------------------------*/
+/* USER CODE BEGIN PM */
+
+/* USER CODE END PM */
+
+/* Private variables ---------------------------------------------------------*/
+TIM_HandleTypeDef htim2;
+
+UART_HandleTypeDef huart2;
+
+/* USER CODE BEGIN PV */
+
+volatile uint32_t g_timerCount = 0;
+
+uint32_t Count = 0;
+
+uint16_t tlmSeq = 0;
+
+uint8_t buf[RH_ASK_MAX_MESSAGE_LEN] = {0};
+uint8_t buflen = 0;
+
+Handle_RF_Log_S rfLog;
+uint32_t logRecoverUs = 0;
+
+uint8_t wdgLoop = WDG_TASK_NONE;
+uint8_t wdgLog = WDG_TASK_NONE;
+const Handle_Fault_Record_S *appFault = NULL;
+const Handle_RF_ResetLog_S *appResetLog = NULL;
+
+#if RF_BULK_ROLE == RF_BULK_ROLE_TX
+Handle_RF_BulkTx_S bulkTx;
+extern uint32_t _sidata, _sdata, _edata;
+#elif RF_BULK_ROLE == RF_BULK_ROLE_RX
+Handle_RF_BulkRx_S bulkRx;
+#endif
+
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+static void MX_USART2_UART_Init(void);
+static void MX_TIM2_Init(void);
+/* USER CODE BEGIN PFP */
+
+/* USER CODE END PFP */
+
+/* Private user code ---------------------------------------------------------*/
+/* USER CODE BEGIN 0 */
+
+/*
+ * @brief : One Fault_Report() line to the console.
+ * @param : line - without line end
+ * @retval : none
+ */
+static void App_FaultLine(const char *line)
+{
+	printf("%s\r", line);
+}
+
+#if TSC_BENCH
+/*
+ * @brief : Encode an hour of 1 s metering readings (V in mV, mA, W, Ws,
+ * 			a steady load with meter noise) and print the Cortex-M0+
+ * 			cycles per sample. Each Tsc_Put() is timed on SysTick with
+ * 			interrupts off, including the frame change when it is full.
+ * @param : none
+ * @retval : none
+ */
+static void App_TscBench(void)
+{
+	static uint8_t frame[APP_TSC_BENCH_FRAME];
+	Handle_Tsc_S tsc;
+	int32_t v[4] = { 230000, 520, 120, 0 };
+	uint32_t rng = 1, t = 0, i, s, e, cyc, overhead, sum = 0, max = 0, bytes = 0, frames = 0;
+	uint32_t reload = SysTick->LOAD + 1U;
+
+	__disable_irq();
+	s = SysTick->VAL;
+	e = SysTick->VAL;
+	__enable_irq();
+	overhead = (s >= e) ? (s - e) : (s + reload - e);
+
+	Tsc_Begin(&tsc, frame, sizeof(frame), 4U, 0x08U);
+	for (i = 0; i < APP_TSC_BENCH_SAMPLES; i++) {
+		rng  = (rng * 1664525U) + 1013904223U;
+		t   += 1000U;
+		v[0] = 230000 + (int32_t)((rng >> 24) & 0x3FU) - 32;
+		v[1] = 520 + (int32_t)((rng >> 16) & 0x07U) - 4;
+		v[2] = ((v[0] / 1000) * v[1]) / 1000;
+		v[3] += v[2];
+
+		__disable_irq();
+		s = SysTick->VAL;
+		if (!Tsc_Put(&tsc, t, v)) {
+			bytes += Tsc_End(&tsc);
+			frames++;
+			Tsc_Begin(&tsc, frame, sizeof(frame), 4U, 0x08U);
+			Tsc_Put(&tsc, t, v);
+		}
+		e = SysTick->VAL;
+		__enable_irq();
+
+		cyc  = ((s >= e) ? (s - e) : (s + reload - e)) - overhead;
+		sum += cyc;
+		max  = (cyc > max) ? cyc : max;
+	}
+	bytes += Tsc_End(&tsc);
+	frames++;
+
+	printf("Tsc bench: %lu samples in %lu frames, %lu bytes (raw %lu), %lu cycles/sample, max %lu, at %lu Hz\r",
+			i, frames, bytes, i * TSC_RAW_LEN(4U), sum / i, max, SystemCoreClock);
+}
+#endif
+
+#if RF_BULK_ROLE
+/*
+ * @brief : Start the image transfer of an RF_BULK_ROLE build. The sender
+ * 			pushes the image it runs, vectors to the end of the .data
+ * 			initialisers; the receiver stores it in the IMAGE region.
+ * @param : none
+ * @retval : none
+ */
+static void App_BulkInit(void)
+{
+#if RF_BULK_ROLE == RF_BULK_ROLE_TX
+	const uint8_t *image = (const uint8_t *)FLASH_BASE;
+	uint32_t length = ((uint32_t)&_sidata + ((uint32_t)&_edata - (uint32_t)&_sdata)) - FLASH_BASE;
+
+	RF_BulkTxInit(&bulkTx, &RF_BulkRhLink, RF_BulkCrc32(image, length), image, length);
+	printf("Bulk: sending %lu bytes, token 0x%08lx\r", length, bulkTx.token);
+#else
+	RF_BulkRxInit(&bulkRx, &RF_BulkRhLink, &RF_BulkFlashSink);
+	printf("Bulk: waiting for an image\r");
+#endif
+}
+
+/*
+ * @brief : One step of the image transfer, in place of the test loop
+ * 			body. The outcome is printed once.
+ * @param : none
+ * @retval : none
+ */
+static void App_BulkPoll(void)
+{
+	static Handle_RF_BulkStatus_E last = RFBulkIdle;
+	static uint32_t start = 0;
+	Handle_RF_BulkStatus_E status;
+
+#if RF_BULK_ROLE == RF_BULK_ROLE_TX
+	status = RF_BulkTxPoll(&bulkTx);
+#else
+	status = RF_BulkRxPoll(&bulkRx);
+#endif
+	if (status == last) {
+		return;
+	}
+	last = status;
+
+	if (status == RFBulkBusy) {
+		start = HAL_GetTick();
+	}
+	else if (status == RFBulkDone) {
+#if RF_BULK_ROLE == RF_BULK_ROLE_TX
+		printf("Bulk: %lu bytes in %lu ms, %lu frames, %lu resends\r", bulkTx.length,
+				HAL_GetTick() - start, bulkTx.frames, bulkTx.resends);
+#else
+		printf("Bulk: image 0x%08lx stored, %lu bytes in %lu ms\r", bulkRx.token, bulkRx.length,
+				HAL_GetTick() - start);
+#endif
+	}
+	else if (status == RFBulkFailed) {
+		printf("Bulk: transfer failed\r");
+	}
+}
+#endif
+
+/* USER CODE END 0 */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* USER CODE BEGIN 1 */
+
+  /* USER CODE END 1 */
+
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* USER CODE BEGIN Init */
+
+  /* Why the supervisor reset the last run, if it did; the .noinit
+   * record is lost on power-off, the EEPROM copy is not */
+  appResetLog = RF_ResetLogInit(Wdg_Init());
+  appFault = Fault_Init();
+  __HAL_RCC_CLEAR_RESET_FLAGS();
+
+  /* USER CODE END Init */
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* USER CODE BEGIN SysInit */
+
+  /* Stack watermark, read back by Ram_UsageGet() for the status record */
+  Ram_StackPaint();
+
+  /* USER CODE END SysInit */
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+  MX_USART2_UART_Init();
+  MX_TIM2_Init();
+  /* USER CODE BEGIN 2 */
+
+  /* HSI16 without the PLL; TIM2 and USART2 are retimed to match */
+  Clock_ProfileInit(&huart2, TIM2, RH_ASK_TICK_HZ);
+  Clock_ProfileSet(ClockNominal);
+
+  /* printf and the Console calls queue into a DMA-drained ring */
+  Console_Init(&huart2);
+
+  printf("/--------------------------------------------------------------/\r");
+  printf("               RF 433Mhz Receiver Test Application              \r");
+  printf("/--------------------------------------------------------------/\r");
+  fflush(stdout);
+
+  /* stdout has its buffer now; from here on buffers come from the pools */
+  RF_PoolInit();
+
+  /* Flash log: find the newest block left before the reset */
+  logRecoverUs = RF_LogStart(&rfLog);
+  printf("Log: %lu blocks, head 0x%04lx, recovered in %lu us\r", rfLog.recovered, rfLog.head, logRecoverUs);
+#if RF_LOG_BENCH
+  RF_LogBench(&rfLog);
+#endif
+#if TSC_BENCH
+  App_TscBench();
+#endif
+
+  RH_ASK_Initialization();
+#if RF_BULK_ROLE
+  App_BulkInit();
+#endif
+
+  if (appResetLog != NULL) {
+	  printf("Watchdog: %s reset for %s, task %u (mask 0x%02x) silent %lu ms, at %lu ms, addr 0x%08lx, %lu in EEPROM\r",
+			  (Wdg_Last.reason != WdgReasonNone) ? "last" : "earlier",
+			  Wdg_ReasonName(appResetLog->last.reason), appResetLog->last.task, appResetLog->last.lateMask,
+			  appResetLog->last.silentMs, appResetLog->last.uptimeMs, appResetLog->last.address, appResetLog->total);
+  }
+  printf("Watchdog: %lu supervised resets since power-on, RCC_CSR 0x%08lx\r", Wdg.resets, Wdg.resetFlags);
+
+  /* IWDG refreshed from SysTick while both tasks keep their deadlines */
+  wdgLoop = Wdg_Register("loop", APP_WDG_LOOP_MS);
+  wdgLog  = Wdg_Register("log", APP_WDG_LOG_MS);
+  Wdg_Start();
+
+  /* Post-mortem of a HardFault in the last run, for Tools/fault_decode.py */
+  if (appFault != NULL) {
+	  Fault_Report(appFault, App_FaultLine);
+  }
+
+  /* USER CODE END 2 */
+
+  /* Infinite loop */
+  /* USER CODE BEGIN WHILE */
+  while (1)
+  {
+    /* USER CODE END WHILE */
+
+    /* USER CODE BEGIN 3 */
+
+	  Wdg_CheckIn(wdgLoop);
+
+#if RF_BULK_ROLE
+	  /* Image transfer build: the loop only moves the transfer, no log */
+	  App_BulkPoll();
+	  Wdg_CheckIn(wdgLog);
+	  continue;
+#endif
+
+	  RH_send((uint8_t *)"Hello World\n", 12);
+	  HAL_Delay(2000);
+
+	  /* RF counters into the flash log, one flash operation per pass */
+	  int16_t logSample[RF_LOG_CHANNELS] = { (int16_t)RH_rxGood(), (int16_t)RH_rxBad(), (int16_t)RH_txGood() };
+	  RF_LogAppend(&rfLog, HAL_GetTick(), logSample);
+	  RF_LogService(&rfLog);
+	  if (rfLog.qCount < RF_LOG_QUEUE) {
+		  Wdg_CheckIn(wdgLog);
+	  }
+
+	  /* RF_TRACE() records from the RH_ASK tick, expanded on the host */
+	  RF_TraceDrain();
+
+	  /* Status record, Tools/telemetry.py decodes it */
+	  uint8_t *tlmBuf = RF_PoolAlloc(APP_TLM_STATUS_MAX);
+	  if (tlmBuf != NULL) {
+		  Handle_Tlm_S tlm;
+		  uint8_t poolHigh[RF_POOL_CLASSES];
+		  uint32_t poolFails = 0, c;
+
+		  Tlm_Begin(&tlm, tlmBuf, APP_TLM_STATUS_MAX, TLM_REC_RF_STATUS, tlmSeq++, HAL_GetTick());
+#if RH_ASK_ISR_PROFILE
+		  if (RH_IsrProfile.count) {
+			  Tlm_PutU16(&tlm, TLM_F_RF_ISR_AVG, (uint16_t)(RH_IsrProfile.cycles / RH_IsrProfile.count));
+			  Tlm_PutU16(&tlm, TLM_F_RF_ISR_MAX, (uint16_t)RH_IsrProfile.maxCycles);
+
+			  /* Per report interval, the cycle sum would wrap in minutes */
+			  RH_IsrProfile.count = 0;
+			  RH_IsrProfile.cycles = 0;
+		  }
+#endif
+		  Tlm_PutU32(&tlm, TLM_F_RF_LOG_DROPPED, Console_Dropped());
+		  Tlm_PutU32(&tlm, TLM_F_RF_TRACE_DROPPED, RF_Trace.dropped);
+		  for (c = 0; c < RF_POOL_CLASSES; c++) {
+			  poolHigh[c] = (uint8_t)RF_Pool[c].highWater;
+			  poolFails += RF_Pool[c].fails;
+		  }
+		  Tlm_PutBytes(&tlm, TLM_F_RF_POOL_HIGH, poolHigh, RF_POOL_CLASSES);
+		  Tlm_PutU32(&tlm, TLM_F_RF_POOL_FAILS, poolFails);
+
+		  Handle_Ram_Usage_S ram;
+		  Ram_UsageGet(&ram);
+		  Tlm_PutU16(&tlm, TLM_F_RF_STACK_PEAK, (uint16_t)ram.stackPeak);
+		  Tlm_PutU16(&tlm, TLM_F_RF_HEAP_USED, (uint16_t)ram.heapUsed);
+
+		  Tlm_PutU32(&tlm, TLM_F_RF_FLOG_BLOCKS, rfLog.blocks);
+		  Tlm_PutU32(&tlm, TLM_F_RF_FLOG_DROPPED, rfLog.dropped);
+		  Tlm_PutU32(&tlm, TLM_F_RF_FLOG_ERRORS, rfLog.errors);
+		  Tlm_PutU32(&tlm, TLM_F_RF_FLOG_RECOVER_US, logRecoverUs);
+		  Tlm_PutU32(&tlm, TLM_F_RF_WDG_RESETS, Wdg.resets);
+		  if (appResetLog != NULL) {
+			  Tlm_PutU8(&tlm, TLM_F_RF_WDG_REASON, appResetLog->last.reason);
+			  Tlm_PutU8(&tlm, TLM_F_RF_WDG_TASK, appResetLog->last.task);
+			  Tlm_PutU32(&tlm, TLM_F_RF_WDG_TOTAL, appResetLog->total);
+		  }
+		  Console_Write((const char *)tlmBuf, Tlm_End(&tlm));
+		  RF_PoolFree(tlmBuf);
+	  }
+
+	  /* Message heard since the last pass, as an rf_rx record. With the
+	   * pool exhausted it is dropped; RF_Pool[].fails counts it */
+	  buflen = RH_ASK_MAX_MESSAGE_LEN;
+	  if (RH_recv(buf, &buflen) == True) {
+		  uint8_t *rxFrame = RF_PoolAlloc(APP_TLM_RX_MAX);
+		  if (rxFrame != NULL) {
+			  Handle_Tlm_S tlm;
+
+			  Tlm_Begin(&tlm, rxFrame, APP_TLM_RX_MAX, TLM_REC_RF_RX, tlmSeq++, HAL_GetTick());
+			  Tlm_PutBytes(&tlm, TLM_F_RF_PAYLOAD, buf, buflen);
+			  Console_Write((const char *)rxFrame, Tlm_End(&tlm));
+			  RF_PoolFree(rxFrame);
+		  }
+	  }
+  }
+
+  /* USER CODE END 3 */
+}
+
+/**
+  * @brief System Clock Configuration
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+
+  /** Configure the main internal regulator output voltage
+  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+  /** Initializes the RCC Oscillators according to the specified parameters
+  * in the RCC_OscInitTypeDef structure.
+  */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLMUL = RCC_PLLMUL_3;
+  RCC_OscInitStruct.PLL.PLLDIV = RCC_PLLDIV_3;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /** Initializes the CPU, AHB and APB buses clocks
+  */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART2;
+  PeriphClkInit.Usart2ClockSelection = RCC_USART2CLKSOURCE_PCLK1;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief TIM2 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM2_Init(void)
+{
+
+  /* USER CODE BEGIN TIM2_Init 0 */
+
+  /* USER CODE END TIM2_Init 0 */
+
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  /* USER CODE BEGIN TIM2_Init 1 */
+
+  /* USER CODE END TIM2_Init 1 */
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = 500;
+  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim2.Init.Period = 1;
+  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim2, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim2, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM2_Init 2 */
+
+  HAL_TIM_Base_Start_IT(&htim2);
+
+  /* USER CODE END TIM2_Init 2 */
+
+}
+
+/**
+  * @brief USART2 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_USART2_UART_Init(void)
+{
+
+  /* USER CODE BEGIN USART2_Init 0 */
+
+  /* USER CODE END USART2_Init 0 */
+
+  /* USER CODE BEGIN USART2_Init 1 */
+
+  /* USER CODE END USART2_Init 1 */
+  huart2.Instance = USART2;
+  huart2.Init.BaudRate = 115200;
+  huart2.Init.WordLength = UART_WORDLENGTH_8B;
+  huart2.Init.StopBits = UART_STOPBITS_1;
+  huart2.Init.Parity = UART_PARITY_NONE;
+  huart2.Init.Mode = UART_MODE_TX_RX;
+  huart2.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  huart2.Init.OverSampling = UART_OVERSAMPLING_16;
+  huart2.Init.OneBitSampling = UART_ONE_BIT_SAMPLE_DISABLE;
+  huart2.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN USART2_Init 2 */
+
+  /* USER CODE END USART2_Init 2 */
+
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_GPIO_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+  /*Configure GPIO pin Output Level */
+  HAL_GPIO_WritePin(GPIOA, RH_TX_Pin|LED_Pin, GPIO_PIN_RESET);
+
+  /*Configure GPIO pins : RH_TX_Pin LED_Pin */
+  GPIO_InitStruct.Pin = RH_TX_Pin|LED_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+  /*Configure GPIO pin : RH_RX_Pin */
+  GPIO_InitStruct.Pin = RH_RX_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(RH_RX_GPIO_Port, &GPIO_InitStruct);
+
+}
+
+/* USER CODE BEGIN 4 */
+
+/**
+  * @brief  Period elapsed callback in non-blocking mode
+  * @param  htim TIM handle
+  * @retval None
+  */
+RAMFUNC void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+	RH_HandleTimerInterrupt_16KHz();
+//	g_timerCount++;
+}
+
+/* USER CODE END 4 */
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  Wdg_Reset(WdgReasonError, (uint32_t)__builtin_return_address(0));
+  /* USER CODE END Error_Handler_Debug */
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+}
+#endif /* USE_FULL_ASSERT */
+
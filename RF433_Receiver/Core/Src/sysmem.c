@@ -23,12 +23,19 @@
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#include "main.h"
 
 /**
  * Pointer to the current high watermark of the heap usage
  */
 static uint8_t *__sbrk_heap_end = NULL;
 
+/**
+ * Set by RF_PoolInit(). Buffers come from the fixed-block pools after
+ * start-up; the heap may not grow any more.
+ */
+uint8_t sbrkSealed = 0;
+
 /**
  * @brief _sbrk() allocates memory to the newlib heap and is used by malloc
  *        and others from the C library
@@ -59,6 +66,12 @@ void *_sbrk(ptrdiff_t incr)
   const uint8_t *max_heap = (uint8_t *)stack_limit;
   uint8_t *prev_heap_end;
 
+  /* Growth after start-up would make allocation latency unbounded */
+  if (sbrkSealed && (incr > 0))
+  {
+    Error_Handler();
+  }
+
   /* Initialize heap end at first call */
   if (NULL == __sbrk_heap_end)
   {
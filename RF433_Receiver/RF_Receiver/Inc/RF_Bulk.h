@@ -0,0 +1,143 @@
+/*
+ * RF_Bulk.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_RF_BULK_H_
+#define INC_RF_BULK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "RH_ASK.h"
+
+/* Define ------------------------------------------------------------*/
+#define RF_BULK_CHUNK_SIZE 				RH_ASK_MAX_MESSAGE_LEN
+#define RF_BULK_WINDOW 					16		/* chunks in flight, <= 32	*/
+#define RF_BULK_ACK_TIMEOUT_MS 			800		/* poll frame + ACK airtime	*/
+#define RF_BULK_MAX_RETRIES 			10
+
+/* Frame type, carried in the low nibble of the FLAGS header */
+#define RF_BULK_START 					0x01
+#define RF_BULK_START_ACK 				0x02
+#define RF_BULK_DATA 					0x03
+#define RF_BULK_ACK 					0x04
+#define RF_BULK_END 					0x05
+#define RF_BULK_END_ACK 				0x06
+#define RF_BULK_TYPE_MASK 				0x07
+#define RF_BULK_FLAG_POLL 				0x08	/* DATA: answer with an ACK	*/
+
+#define RF_BULK_REFUSE 					0xFFFFFFFFU
+
+/* Build with RF_BULK_ROLE=1 to send this image, 2 to receive one (RF433 receiver main.c) */
+#ifndef RF_BULK_ROLE
+#define RF_BULK_ROLE 					0
+#endif
+#define RF_BULK_ROLE_TX 				1
+#define RF_BULK_ROLE_RX 				2
+
+/*
+ *  ------------------ Bulk transfer frames (payload) ----------------------
+	START     (sender)   : token(4) length(4)
+	START_ACK (receiver) : token(4) resume chunk(4) status(1)
+	DATA      (sender)   : chunk data, ID header = chunk number & 0xFF
+	ACK       (receiver) : next expected chunk(4) received bitmap(4) status(1)
+	END       (sender)   : token(4)
+	END_ACK   (receiver) : token(4) status(1)
+
+	Bit i of the ACK bitmap is chunk (next expected + i). A clear bit
+	below the highest set bit is a NACK for that chunk. The token names
+	the image (its CRC); a START with the token of an unfinished transfer
+	resumes it at the chunk returned in START_ACK.
+*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief Transfer state returned by the poll functions
+ */
+typedef enum
+{
+	RFBulkIdle = 0,						/* nothing in progress				*/
+	RFBulkBusy,							/* transfer running					*/
+	RFBulkDone,							/* image delivered and accepted		*/
+	RFBulkFailed						/* refused, sink error or no answer	*/
+
+} Handle_RF_BulkStatus_E;
+
+/*
+ * @brief Frame transport: RH_ASK on target, a simulated link on the host
+ */
+typedef struct {
+	Bool_E		(*send)(uint8_t flags, uint8_t id, const uint8_t *data, uint8_t len);
+	Bool_E		(*recv)(uint8_t *flags, uint8_t *id, uint8_t *data, uint8_t *len);
+	uint32_t	(*tick)(void);			/* milliseconds						*/
+
+}Handle_RF_BulkLink_S;
+
+/*
+ * @brief Receiver side image consumer, data is delivered in order
+ */
+typedef struct {
+	uint32_t	(*begin)(uint32_t token, uint32_t length);	/* resume chunk or RF_BULK_REFUSE */
+	int			(*write)(uint32_t offset, const uint8_t *data, uint8_t len);
+	int			(*end)(void);			/* 0 when the image is accepted		*/
+
+}Handle_RF_BulkSink_S;
+
+typedef struct {
+	const Handle_RF_BulkLink_S *link;
+	const uint8_t 	*image;
+	uint32_t 		length;
+	uint32_t 		token;
+	uint32_t 		chunks;
+	uint32_t 		base;				/* oldest chunk not acknowledged	*/
+	uint32_t 		acked;				/* bit i: chunk base+i acknowledged	*/
+	uint32_t 		cursor;				/* next chunk of the current burst	*/
+	uint32_t 		last;				/* chunk that carries the poll		*/
+	uint32_t 		sent;				/* chunks sent at least once		*/
+	uint32_t 		lastTx;
+	uint32_t 		frames;				/* frames sent, all types			*/
+	uint32_t 		resends;			/* DATA frames sent more than once	*/
+	uint8_t 		state;
+	uint8_t 		retries;
+
+}Handle_RF_BulkTx_S;
+
+typedef struct {
+	const Handle_RF_BulkLink_S *link;
+	const Handle_RF_BulkSink_S *sink;
+	uint32_t 		token;
+	uint32_t 		length;
+	uint32_t 		chunks;
+	uint32_t 		base;				/* next chunk handed to the sink	*/
+	uint32_t 		have;				/* bit i: chunk base+i buffered		*/
+	uint8_t 		status;
+	uint8_t 		state;
+	uint8_t 		buf[RF_BULK_WINDOW][RF_BULK_CHUNK_SIZE];
+
+}Handle_RF_BulkRx_S;
+
+/* Function prototypes -----------------------------------------------*/
+void RF_BulkTxInit(Handle_RF_BulkTx_S *tx, const Handle_RF_BulkLink_S *link,
+					uint32_t token, const uint8_t *image, uint32_t length);
+Handle_RF_BulkStatus_E RF_BulkTxPoll(Handle_RF_BulkTx_S *tx);
+void RF_BulkRxInit(Handle_RF_BulkRx_S *rx, const Handle_RF_BulkLink_S *link,
+					const Handle_RF_BulkSink_S *sink);
+Handle_RF_BulkStatus_E RF_BulkRxPoll(Handle_RF_BulkRx_S *rx);
+uint32_t RF_BulkCrc32(const uint8_t *data, uint32_t len);
+
+extern const Handle_RF_BulkLink_S RF_BulkRhLink;		/* RF_BulkLink.c		*/
+extern const Handle_RF_BulkSink_S RF_BulkFlashSink;		/* RF_BulkFlash.c		*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_RF_BULK_H_ */
@@ -0,0 +1,133 @@
+/*
+ * RF_Log.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_RF_LOG_H_
+#define INC_RF_LOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+
+/* Define ------------------------------------------------------------*/
+#define RF_LOG_PAGE_SIZE 				128U	/* erase unit				*/
+#define RF_LOG_BLOCK_SIZE 				64U		/* half-page, program unit	*/
+#define RF_LOG_CHANNELS 				3U
+#define RF_LOG_DELTAS 					11U		/* samples after the base	*/
+#define RF_LOG_SAMPLES 					(RF_LOG_DELTAS + 1U)
+#define RF_LOG_DT_UNIT_MS 				10U		/* delta time resolution	*/
+#define RF_LOG_QUEUE 					4U		/* closed blocks not yet in flash */
+#define RF_LOG_MAGIC 					0x4CU	/* 'L'						*/
+
+/* Build with RF_LOG_BENCH=1 to measure the log at boot; it overwrites the log */
+#ifndef RF_LOG_BENCH
+#define RF_LOG_BENCH 					0
+#endif
+
+/*
+ *  ------------------ Log block (one half-page, 64 bytes) ------------------
+	+-----------+-----------+----------------------+-------+-------+
+	| seq (4)   | time (4)  | base[3] (6)          | count | magic |
+	+-----------+-----------+----------------------+-------+-------+
+	| delta[0..10]: dt (1, x10 ms) d[3] (1 each, signed)   (44)    |
+	+--------------------------------------------------------------+
+	| crc (4): CRC-32 of the 60 bytes before                       |
+	+--------------------------------------------------------------+
+
+	A sample that does not fit a delta (dt over 2.55 s or a step over
+	+-127) closes the block and becomes the base of the next one.
+	Erased flash reads 0 on the L0, so seq starts at 1. The block is
+	programmed in one half-page operation with the CRC as its last
+	word: a block interrupted by a reset fails the CRC and is skipped,
+	the CRC is the commit marker.
+*/
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+typedef struct {
+	uint8_t 	dt;						/* RF_LOG_DT_UNIT_MS units			*/
+	int8_t 		d[RF_LOG_CHANNELS];
+
+}Handle_RF_LogDelta_S;
+
+typedef struct {
+	uint32_t 				seq;
+	uint32_t 				time;		/* ms of the base sample			*/
+	int16_t 				base[RF_LOG_CHANNELS];
+	uint8_t 				count;		/* samples, base included			*/
+	uint8_t 				magic;
+	Handle_RF_LogDelta_S 	delta[RF_LOG_DELTAS];
+	uint32_t 				crc;
+
+}Handle_RF_LogBlock_S;
+
+/*
+ * @brief Flash under the log: the STM32 NVM on target, an array on the
+ * 	host. erase() and program() start the operation and return at once,
+ * 	program() has taken the 16 words by then; status() reports it:
+ * 	1 busy, 0 done, -1 the last operation failed.
+ */
+typedef struct {
+	const uint8_t 	*mem;				/* region, memory mapped			*/
+	uint32_t 		size;				/* bytes, whole pages				*/
+	int 			(*status)(void);
+	void 			(*erase)(uint32_t offset);
+	void 			(*program)(uint32_t offset, const uint32_t *words);
+
+}Handle_RF_LogFlash_S;
+
+typedef struct {
+	const Handle_RF_LogFlash_S *flash;
+	uint32_t 		head;				/* offset of the next block			*/
+	uint32_t 		ahead;				/* bytes known erased from head on	*/
+	uint32_t 		seq;				/* of the next block				*/
+	uint8_t 		op;					/* operation in flight				*/
+
+	Handle_RF_LogBlock_S 	build;		/* block being filled				*/
+	uint32_t 		lastTime;			/* time and values as the			*/
+	int16_t 		last[RF_LOG_CHANNELS];	/* decoder will rebuild them	*/
+
+	Handle_RF_LogBlock_S 	queue[RF_LOG_QUEUE];
+	uint8_t 		qHead;
+	uint8_t 		qCount;
+
+	uint32_t 		samples;			/* appended							*/
+	uint32_t 		blocks;				/* programmed						*/
+	uint32_t 		erases;
+	uint32_t 		dropped;			/* samples lost to a full queue		*/
+	uint32_t 		errors;				/* failed flash operations			*/
+	uint32_t 		recovered;			/* blocks with a header at RF_LogInit	*/
+	uint32_t 		skipped;			/* torn blocks stepped over			*/
+	uint32_t 		scanWords;			/* flash words read by RF_LogInit	*/
+
+}Handle_RF_Log_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+void RF_LogInit(Handle_RF_Log_S *log, const Handle_RF_LogFlash_S *flash);
+void RF_LogAppend(Handle_RF_Log_S *log, uint32_t ms, const int16_t *values);
+void RF_LogFlush(Handle_RF_Log_S *log);
+uint8_t RF_LogService(Handle_RF_Log_S *log);
+const Handle_RF_LogBlock_S *RF_LogBlock(const Handle_RF_Log_S *log, uint32_t offset);
+uint8_t RF_LogDecode(const Handle_RF_LogBlock_S *blk, uint32_t *times, int16_t (*values)[RF_LOG_CHANNELS]);
+
+uint32_t RF_LogStart(Handle_RF_Log_S *log);
+void RF_LogBench(Handle_RF_Log_S *log);
+
+extern const Handle_RF_LogFlash_S RF_LogStmFlash;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_RF_LOG_H_ */
@@ -0,0 +1,61 @@
+/*
+ * RF_Pool.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_RF_POOL_H_
+#define INC_RF_POOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define RF_POOL_CLASSES 				4U
+
+/*
+ * Block size and count per class, smallest first. The total must fit
+ * _Pool_Size in the linker script (2 KB):
+ * 16 x 32 + 32 x 16 + 64 x 8 + 128 x 4 = 2048
+ */
+#define RF_POOL_CLASS_TABLE 			{ {16U, 32U}, {32U, 16U}, {64U, 8U}, {128U, 4U} }
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief One size class: a free list threaded through its blocks
+ */
+typedef struct {
+	uint8_t 	*base;					/* first block						*/
+	uint8_t 	*limit;					/* one past the last block			*/
+	void 		*free;					/* free list head					*/
+	uint16_t 	size;					/* block size, multiple of 4		*/
+	uint16_t 	count;
+	uint16_t 	inUse;
+	uint16_t 	highWater;
+	uint32_t 	fails;					/* requests that found it empty		*/
+
+}Handle_RF_Pool_S;
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_RF_Pool_S RF_Pool[RF_POOL_CLASSES];
+
+/* Function prototypes -----------------------------------------------*/
+void RF_PoolInit(void);
+void *RF_PoolAlloc(uint16_t size);
+void RF_PoolFree(void *block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_RF_POOL_H_ */
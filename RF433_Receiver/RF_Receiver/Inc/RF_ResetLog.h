@@ -0,0 +1,48 @@
+/*
+ * RF_ResetLog.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_RF_RESETLOG_H_
+#define INC_RF_RESETLOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "Watchdog.h"
+
+/* Define ------------------------------------------------------------*/
+#define RF_RESET_LOG_ADDRESS 			(DATA_EEPROM_BASE + 0x40UL)	/* after the RF_BulkFlash resume point */
+#define RF_RESET_LOG_MAGIC 				0x52534C47UL		/* "RSLG" */
+
+/* Macro -------------------------------------------------------------*/
+
+/* Typedef -----------------------------------------------------------*/
+/*
+ * @brief Last supervised reset, copied from Wdg_Last into data EEPROM so
+ * 	it outlives a power cycle, which the .noinit.wdg record does not.
+ */
+typedef struct {
+	uint32_t 				magic;
+	uint32_t 				total;			/* supervised resets, power cycles included	*/
+	Handle_Wdg_Record_S 	last;
+
+}Handle_RF_ResetLog_S;
+
+/* Variables ---------------------------------------------------------*/
+
+/* Function prototypes -----------------------------------------------*/
+const Handle_RF_ResetLog_S *RF_ResetLogInit(const Handle_Wdg_Record_S *last);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_RF_RESETLOG_H_ */
@@ -0,0 +1,104 @@
+/*
+ * RF_Trace.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Define to prevent recursive inclusion -----------------------------*/
+
+#ifndef INC_RF_TRACE_H_
+#define INC_RF_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include "main.h"
+
+/* Define ------------------------------------------------------------*/
+#define RF_TRACE_ENABLE 				1
+#define RF_TRACE_WORDS 					256U		/* ring, power of two		*/
+#define RF_TRACE_DRAIN_MAX 				16U			/* records per drain call	*/
+
+/*
+ *  ------------------------ Trace record (words) --------------------------
+ *  | ID[31:16] | NARGS[15:13] | MS[12:0] | ARG0 | .. | ARGn-1 |
+ *  ------------------------------------------------------------------------
+ *  ID is the offset of the format string in the .trace_fmt ELF section,
+ *  which is never loaded; Tools/trace_decode.py reads it from the ELF.
+ *  MS is HAL_GetTick() modulo 8192.
+ */
+#define RF_TRACE_MS_MASK 				0x1FFFU
+
+/* Macro -------------------------------------------------------------*/
+#if RF_TRACE_ENABLE
+
+#define RF_TRACE_NARGS_(_0, _1, _2, _3, _4, n, ...) 	n
+#define RF_TRACE_NARGS(...) 			RF_TRACE_NARGS_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+
+/*
+ * @brief Log an event: format string ID plus up to four 32-bit arguments.
+ * 		  No formatting on the target; %s is not supported.
+ */
+#define RF_TRACE(fmt, ...) 																	\
+	do {																					\
+		static const char RF_TraceFmt_[] __attribute__((section(".trace_fmt"), used)) = fmt;\
+		const uint32_t RF_TraceArg_[] = { 0, ##__VA_ARGS__ };								\
+		RF_TraceEmit((uint32_t)RF_TraceFmt_, RF_TRACE_NARGS(__VA_ARGS__), &RF_TraceArg_[1]);	\
+	} while (0)
+
+#else
+
+#define RF_TRACE(fmt, ...) 				do { } while (0)
+
+#endif
+
+/* Typedef -----------------------------------------------------------*/
+typedef struct {
+	uint32_t 			ring[RF_TRACE_WORDS];
+	volatile uint32_t 	head;					/* free running word counts	*/
+	volatile uint32_t 	tail;
+	uint32_t 			dropped;				/* records, ring full or line cut */
+
+}Handle_RF_Trace_S;
+
+/* Variables ---------------------------------------------------------*/
+extern Handle_RF_Trace_S RF_Trace;
+
+/* Function prototypes -----------------------------------------------*/
+void RF_TraceDrain(void);
+
+/*
+ * @brief : Append one record; any context, interrupts masked for the copy.
+ * @param : id   - format string offset in .trace_fmt
+ * 			n    - argument count, 0..4
+ * 			args - argument words
+ * @retval : none
+ */
+__attribute__((always_inline)) static inline void RF_TraceEmit(uint32_t id, uint32_t n, const uint32_t *args)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t head, i;
+
+	__disable_irq();
+	head = RF_Trace.head;
+	if ((RF_TRACE_WORDS - (head - RF_Trace.tail)) < (n + 1U)) {
+		RF_Trace.dropped++;
+	} else {
+		RF_Trace.ring[head++ & (RF_TRACE_WORDS - 1U)] = (id << 16) | (n << 13) | (uwTick & RF_TRACE_MS_MASK);
+		for (i = 0; i < n; i++) {
+			RF_Trace.ring[head++ & (RF_TRACE_WORDS - 1U)] = args[i];
+		}
+		RF_Trace.head = head;
+	}
+	__set_PRIMASK(primask);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_RF_TRACE_H_ */
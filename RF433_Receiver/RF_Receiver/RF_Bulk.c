@@ -0,0 +1,382 @@
+/*
+ * RF_Bulk.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Reliable bulk transfer over single RH_ASK messages. The sender runs
+ *  a selective repeat window: it sends a burst of up to RF_BULK_WINDOW
+ *  chunks, polls on the last one and resends only the chunks that the
+ *  ACK bitmap reports missing. The link is half duplex, so the receiver
+ *  answers only when polled. No HAL calls, the link and the sink are
+ *  callbacks, so the same file runs in the host simulation.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Bulk.h"
+#include <string.h>
+
+/* Define --------------------------------------------------------------------*/
+#define RF_BULK_STATE_IDLE 				0
+#define RF_BULK_STATE_START 			1
+#define RF_BULK_STATE_BURST 			2
+#define RF_BULK_STATE_WAIT 				3
+#define RF_BULK_STATE_END 				4
+#define RF_BULK_STATE_DONE 				5
+#define RF_BULK_STATE_FAILED 			6
+
+#define RF_BULK_OK 						0
+#define RF_BULK_ERR_REFUSED 			1
+#define RF_BULK_ERR_SINK 				2
+
+/* Macro ---------------------------------------------------------------------*/
+#define RF_BULK_CHUNKS(len) 			(((len) + RF_BULK_CHUNK_SIZE - 1U) / RF_BULK_CHUNK_SIZE)
+
+/* Function prototypes -------------------------------------------------------*/
+
+static void RF_BulkPut32(uint8_t *p, uint32_t v)
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+	p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t RF_BulkGet32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*
+ * @brief : Size of a chunk, the last one may be short
+ * @param : length - image length
+ * 			chunk  - chunk number
+ * @retval : uint8_t - bytes in the chunk
+ */
+static uint8_t RF_BulkChunkLen(uint32_t length, uint32_t chunk)
+{
+	uint32_t left = length - (chunk * RF_BULK_CHUNK_SIZE);
+
+	return (uint8_t)((left > RF_BULK_CHUNK_SIZE) ? RF_BULK_CHUNK_SIZE : left);
+}
+
+/*
+ * @brief : Send a frame and remember when, for the answer timeout
+ * @param : tx - sender
+ * @retval : none
+ */
+static void RF_BulkTxSend(Handle_RF_BulkTx_S *tx, uint8_t flags, uint8_t id,
+							const uint8_t *data, uint8_t len)
+{
+	tx->link->send(flags, id, data, len);
+	tx->lastTx = tx->link->tick();
+	tx->frames++;
+}
+
+/*
+ * @brief : Plan the next burst: every chunk of the window not yet acknowledged
+ * @param : tx - sender
+ * @retval : none
+ */
+static void RF_BulkTxPlan(Handle_RF_BulkTx_S *tx)
+{
+	uint32_t end = tx->base + RF_BULK_WINDOW;
+	uint32_t i;
+
+	if (end > tx->chunks) {
+		end = tx->chunks;
+	}
+	tx->cursor = tx->base;
+	tx->last   = tx->base;
+	for (i = tx->base; i < end; i++) {
+		if (!(tx->acked & (1UL << (i - tx->base)))) {
+			tx->last = i;
+		}
+	}
+	if (tx->base < tx->chunks) {
+		tx->state = RF_BULK_STATE_BURST;
+	} else {
+		tx->state  = RF_BULK_STATE_END;		/* send END without waiting	*/
+		tx->lastTx = tx->link->tick() - RF_BULK_ACK_TIMEOUT_MS;
+	}
+}
+
+/*
+ * @brief : Apply an ACK: slide the window and merge the received bitmap
+ * @param : tx   - sender
+ * 			data - ACK payload
+ * @retval : none
+ */
+static void RF_BulkTxAck(Handle_RF_BulkTx_S *tx, const uint8_t *data)
+{
+	uint32_t base = RF_BulkGet32(&data[0]);
+	uint32_t have = RF_BulkGet32(&data[4]);
+
+	if (data[8] != RF_BULK_OK) {
+		tx->state = RF_BULK_STATE_FAILED;
+		return;
+	}
+	if ((base < tx->base) || (base > tx->chunks)) {
+		return;							/* stale or foreign ACK		*/
+	}
+	tx->acked  = ((base - tx->base) < 32U) ? (tx->acked >> (base - tx->base)) : 0U;
+	tx->acked |= have;
+	tx->base   = base;
+	tx->retries = 0;
+	RF_BulkTxPlan(tx);
+}
+
+/*
+ * @brief : Start sending an image
+ * @param : tx     - sender
+ * 			link   - frame transport
+ * 			token  - image identity, an unfinished transfer with the same token resumes
+ * 			image  - image data
+ * 			length - image length
+ * @retval : none
+ */
+void RF_BulkTxInit(Handle_RF_BulkTx_S *tx, const Handle_RF_BulkLink_S *link,
+					uint32_t token, const uint8_t *image, uint32_t length)
+{
+	memset(tx, 0, sizeof(*tx));
+	tx->link   = link;
+	tx->image  = image;
+	tx->length = length;
+	tx->token  = token;
+	tx->chunks = RF_BULK_CHUNKS(length);
+	tx->state  = RF_BULK_STATE_START;
+	tx->lastTx = link->tick() - RF_BULK_ACK_TIMEOUT_MS;
+}
+
+/*
+ * @brief : Sender state machine, sends at most one frame per call
+ * @param : tx - sender
+ * @retval : Handle_RF_BulkStatus_E - transfer state
+ */
+Handle_RF_BulkStatus_E RF_BulkTxPoll(Handle_RF_BulkTx_S *tx)
+{
+	uint8_t frame[RF_BULK_CHUNK_SIZE];
+	uint8_t flags, id, len = sizeof(frame);
+
+	/* Answers from the receiver */
+	if (tx->link->recv(&flags, &id, frame, &len) == True) {
+		flags &= RF_BULK_TYPE_MASK;
+		if ((flags == RF_BULK_START_ACK) && (len >= 9) && (tx->state == RF_BULK_STATE_START)
+				&& (RF_BulkGet32(&frame[0]) == tx->token)) {
+			if ((frame[8] != RF_BULK_OK) || (RF_BulkGet32(&frame[4]) > tx->chunks)) {
+				tx->state = RF_BULK_STATE_FAILED;
+			} else {
+				tx->base = tx->sent = RF_BulkGet32(&frame[4]);
+				tx->retries = 0;
+				RF_BulkTxPlan(tx);
+			}
+		} else if ((flags == RF_BULK_ACK) && (len >= 9) && ((tx->state == RF_BULK_STATE_WAIT)
+				|| (tx->state == RF_BULK_STATE_END))) {
+			RF_BulkTxAck(tx, frame);
+		} else if ((flags == RF_BULK_END_ACK) && (len >= 5) && (tx->state == RF_BULK_STATE_END)
+				&& (RF_BulkGet32(&frame[0]) == tx->token)) {
+			tx->state = (frame[4] == RF_BULK_OK) ? RF_BULK_STATE_DONE : RF_BULK_STATE_FAILED;
+		}
+	}
+
+	switch (tx->state) {
+
+	case RF_BULK_STATE_BURST:
+		while ((tx->cursor < tx->last) && (tx->acked & (1UL << (tx->cursor - tx->base)))) {
+			tx->cursor++;
+		}
+		flags = RF_BULK_DATA;
+		if (tx->cursor == tx->last) {
+			flags |= RF_BULK_FLAG_POLL;
+			tx->state = RF_BULK_STATE_WAIT;
+		}
+		if (tx->cursor < tx->sent) {
+			tx->resends++;
+		} else {
+			tx->sent = tx->cursor + 1U;
+		}
+		RF_BulkTxSend(tx, flags, (uint8_t)tx->cursor,
+						&tx->image[tx->cursor * RF_BULK_CHUNK_SIZE],
+						RF_BulkChunkLen(tx->length, tx->cursor));
+		tx->cursor++;
+		break;
+
+	case RF_BULK_STATE_START:
+	case RF_BULK_STATE_WAIT:
+	case RF_BULK_STATE_END:
+		if ((tx->link->tick() - tx->lastTx) < RF_BULK_ACK_TIMEOUT_MS) {
+			break;
+		}
+		if (tx->retries++ >= RF_BULK_MAX_RETRIES) {
+			tx->state = RF_BULK_STATE_FAILED;
+			break;
+		}
+		if (tx->state == RF_BULK_STATE_START) {
+			RF_BulkPut32(&frame[0], tx->token);
+			RF_BulkPut32(&frame[4], tx->length);
+			RF_BulkTxSend(tx, RF_BULK_START, 0, frame, 8);
+		} else if (tx->state == RF_BULK_STATE_END) {
+			RF_BulkPut32(&frame[0], tx->token);
+			RF_BulkTxSend(tx, RF_BULK_END, 0, frame, 4);
+		} else {
+			/* Poll or ACK lost: repeat the oldest chunk only to get the bitmap back */
+			tx->resends++;
+			RF_BulkTxSend(tx, RF_BULK_DATA | RF_BULK_FLAG_POLL, (uint8_t)tx->base,
+							&tx->image[tx->base * RF_BULK_CHUNK_SIZE],
+							RF_BulkChunkLen(tx->length, tx->base));
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	switch (tx->state) {
+	case RF_BULK_STATE_IDLE:	return RFBulkIdle;
+	case RF_BULK_STATE_DONE:	return RFBulkDone;
+	case RF_BULK_STATE_FAILED:	return RFBulkFailed;
+	default:					return RFBulkBusy;
+	}
+}
+
+/*
+ * @brief : Receiver answer to a poll: window position and received bitmap
+ * @param : rx - receiver
+ * @retval : none
+ */
+static void RF_BulkRxAck(Handle_RF_BulkRx_S *rx)
+{
+	uint8_t frame[9];
+
+	RF_BulkPut32(&frame[0], rx->base);
+	RF_BulkPut32(&frame[4], rx->have);
+	frame[8] = rx->status;
+	rx->link->send(RF_BULK_ACK, (uint8_t)rx->base, frame, sizeof(frame));
+}
+
+/*
+ * @brief : Store a DATA frame and hand every in-order chunk to the sink
+ * @param : rx   - receiver
+ * 			id   - low 8 bits of the chunk number
+ * 			data - chunk data
+ * 			len  - chunk length
+ * @retval : none
+ */
+static void RF_BulkRxData(Handle_RF_BulkRx_S *rx, uint8_t id, const uint8_t *data, uint8_t len)
+{
+	uint8_t  slot = (uint8_t)(id - (uint8_t)rx->base);
+	uint32_t chunk = rx->base + slot;
+
+	if ((slot >= RF_BULK_WINDOW) || (chunk >= rx->chunks)
+			|| (len != RF_BulkChunkLen(rx->length, chunk))) {
+		return;							/* duplicate of a delivered chunk	*/
+	}
+	if (!(rx->have & (1UL << slot))) {
+		memcpy(rx->buf[chunk % RF_BULK_WINDOW], data, len);
+		rx->have |= (1UL << slot);
+	}
+	while ((rx->have & 1U) && (rx->status == RF_BULK_OK)) {
+		if (rx->sink->write(rx->base * RF_BULK_CHUNK_SIZE, rx->buf[rx->base % RF_BULK_WINDOW],
+							RF_BulkChunkLen(rx->length, rx->base)) != 0) {
+			rx->status = RF_BULK_ERR_SINK;
+			break;
+		}
+		rx->have >>= 1;
+		rx->base++;
+	}
+}
+
+/*
+ * @brief : Wait for an image
+ * @param : rx   - receiver
+ * 			link - frame transport
+ * 			sink - image consumer
+ * @retval : none
+ */
+void RF_BulkRxInit(Handle_RF_BulkRx_S *rx, const Handle_RF_BulkLink_S *link,
+					const Handle_RF_BulkSink_S *sink)
+{
+	memset(rx, 0, sizeof(*rx));
+	rx->link = link;
+	rx->sink = sink;
+}
+
+/*
+ * @brief : Receiver state machine, handles at most one frame per call
+ * @param : rx - receiver
+ * @retval : Handle_RF_BulkStatus_E - transfer state
+ */
+Handle_RF_BulkStatus_E RF_BulkRxPoll(Handle_RF_BulkRx_S *rx)
+{
+	uint8_t frame[RF_BULK_CHUNK_SIZE];
+	uint8_t flags, id, len = sizeof(frame);
+	uint32_t token, resume;
+
+	if (rx->link->recv(&flags, &id, frame, &len) == True) {
+
+		switch (flags & RF_BULK_TYPE_MASK) {
+
+		case RF_BULK_START:
+			if (len < 8) {
+				break;
+			}
+			token = RF_BulkGet32(&frame[0]);
+			if ((rx->state == RF_BULK_STATE_IDLE) || (token != rx->token)) {
+				rx->token  = token;
+				rx->length = RF_BulkGet32(&frame[4]);
+				rx->chunks = RF_BULK_CHUNKS(rx->length);
+				rx->have   = 0;
+				rx->status = RF_BULK_OK;
+				resume = rx->sink->begin(token, rx->length);
+				if ((resume == RF_BULK_REFUSE) || (resume > rx->chunks)) {
+					rx->status = RF_BULK_ERR_REFUSED;
+					resume = 0;
+				}
+				rx->base  = resume;
+				rx->state = (rx->status == RF_BULK_OK) ? RF_BULK_STATE_BURST : RF_BULK_STATE_FAILED;
+			}
+			RF_BulkPut32(&frame[4], rx->base);
+			frame[8] = rx->status;
+			rx->link->send(RF_BULK_START_ACK, 0, frame, 9);
+			break;
+
+		case RF_BULK_DATA:
+			if (rx->state != RF_BULK_STATE_BURST) {
+				break;
+			}
+			RF_BulkRxData(rx, id, frame, len);
+			if (flags & RF_BULK_FLAG_POLL) {
+				RF_BulkRxAck(rx);
+			}
+			break;
+
+		case RF_BULK_END:
+			if ((len < 4) || (rx->state == RF_BULK_STATE_IDLE) || (RF_BulkGet32(&frame[0]) != rx->token)) {
+				break;
+			}
+			if (rx->base < rx->chunks) {
+				RF_BulkRxAck(rx);		/* not complete, sender resumes	*/
+				break;
+			}
+			if (rx->state == RF_BULK_STATE_BURST) {
+				if ((rx->status == RF_BULK_OK) && (rx->sink->end() != 0)) {
+					rx->status = RF_BULK_ERR_SINK;
+				}
+				rx->state = (rx->status == RF_BULK_OK) ? RF_BULK_STATE_DONE : RF_BULK_STATE_FAILED;
+			}
+			frame[4] = rx->status;
+			rx->link->send(RF_BULK_END_ACK, 0, frame, 5);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	switch (rx->state) {
+	case RF_BULK_STATE_IDLE:	return RFBulkIdle;
+	case RF_BULK_STATE_DONE:	return RFBulkDone;
+	case RF_BULK_STATE_FAILED:	return RFBulkFailed;
+	default:					return RFBulkBusy;
+	}
+}
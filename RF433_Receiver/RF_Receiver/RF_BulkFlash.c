@@ -0,0 +1,221 @@
+/*
+ * RF_BulkFlash.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  RF_Bulk receiver sink: stores an image in the IMAGE region, bank 2
+ *  below the RF_Log ring (linker script). Chunks arrive in order and are
+ *  collected into 64 byte half-pages; a page is erased when the first
+ *  half-page reaches it. The resume point is saved to data EEPROM every
+ *  RF_BULK_FLASH_SAVE bytes, so a transfer interrupted by a reset carries
+ *  on from there. The code runs from bank 1, so flash operations never
+ *  stall it; each one is waited for (~3 ms), far shorter than a chunk's
+ *  airtime.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Bulk.h"
+#include "main.h"
+
+/* Define --------------------------------------------------------------------*/
+#define RF_BULK_FLASH_BASE 				0x08018000UL	/* IMAGE region in the .ld	*/
+#define RF_BULK_FLASH_SIZE 				(80U * 1024U)
+#define RF_BULK_FLASH_PAGE 				128U
+#define RF_BULK_FLASH_BLOCK 			64U				/* half-page				*/
+#define RF_BULK_FLASH_SAVE 				1024U			/* resume point interval	*/
+
+#define RF_BULK_FLASH_RESUME 			DATA_EEPROM_BASE
+
+/* Typedef -------------------------------------------------------------------*/
+/*
+ * @brief Resume point in data EEPROM, the image token names the transfer
+ */
+typedef struct {
+	uint32_t 	token;
+	uint32_t 	length;
+	uint32_t 	done;					/* bytes in flash, page aligned		*/
+
+}Handle_RF_BulkFlashResume_S;
+
+typedef struct {
+	uint32_t 	token;
+	uint32_t 	length;
+	uint32_t 	done;					/* bytes programmed					*/
+	uint32_t 	block[RF_BULK_FLASH_BLOCK / 4U];
+	uint8_t 	fill;					/* bytes collected in block			*/
+
+}Handle_RF_BulkFlash_S;
+
+/* Variables -----------------------------------------------------------------*/
+static Handle_RF_BulkFlash_S RF_BulkFlash;
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : CRC-32 (IEEE, reflected), the token a sender names an image by
+ * @param : data - bytes
+ * 			len  - byte count
+ * @retval : uint32_t - CRC
+ */
+uint32_t RF_BulkCrc32(const uint8_t *data, uint32_t len)
+{
+	uint32_t crc = 0xFFFFFFFFU;
+	uint8_t k;
+
+	while (len--) {
+		crc ^= *data++;
+		for (k = 0; k < 8; k++) {
+			crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+		}
+	}
+	return ~crc;
+}
+
+/*
+ * @brief : Save one word of the resume point
+ * @param : field - word in the EEPROM record
+ * 			value - new value
+ * @retval : none
+ */
+static void RF_BulkFlashSave(volatile uint32_t *field, uint32_t value)
+{
+	if (*field == value) {
+		return;
+	}
+	HAL_FLASHEx_DATAEEPROM_Unlock();
+	HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAM_WORD, (uint32_t)field, value);
+	HAL_FLASHEx_DATAEEPROM_Lock();
+}
+
+/*
+ * @brief : Program the collected half-page, erasing its page first when
+ * 			it is the first half-page of it
+ * @param : none
+ * @retval : int - 0 when programmed
+ */
+static int RF_BulkFlashBlock(void)
+{
+	volatile Handle_RF_BulkFlashResume_S *resume = (volatile Handle_RF_BulkFlashResume_S *)RF_BULK_FLASH_RESUME;
+	FLASH_EraseInitTypeDef erase = {0};
+	uint32_t address = RF_BULK_FLASH_BASE + RF_BulkFlash.done;
+	uint32_t pageError = 0;
+	HAL_StatusTypeDef status = HAL_OK;
+
+	HAL_FLASH_Unlock();
+	if ((RF_BulkFlash.done % RF_BULK_FLASH_PAGE) == 0) {
+		erase.TypeErase 	= FLASH_TYPEERASE_PAGES;
+		erase.PageAddress 	= address;
+		erase.NbPages 		= 1;
+		status = HAL_FLASHEx_Erase(&erase, &pageError);
+	}
+	if (status == HAL_OK) {
+		status = HAL_FLASHEx_HalfPageProgram(address, RF_BulkFlash.block);
+	}
+	HAL_FLASH_Lock();
+
+	if (status != HAL_OK) {
+		return -1;
+	}
+
+	RF_BulkFlash.done += RF_BULK_FLASH_BLOCK;
+	RF_BulkFlash.fill  = 0;
+	if ((RF_BulkFlash.done % RF_BULK_FLASH_SAVE) == 0) {
+		RF_BulkFlashSave(&resume->done, RF_BulkFlash.done);
+	}
+	return 0;
+}
+
+/*
+ * @brief : New transfer, or the rest of the one in the resume point
+ * @param : token  - image CRC
+ * 			length - image bytes
+ * @retval : uint32_t - chunk to resume at, RF_BULK_REFUSE if it does not fit
+ */
+static uint32_t RF_BulkFlashBegin(uint32_t token, uint32_t length)
+{
+	volatile Handle_RF_BulkFlashResume_S *resume = (volatile Handle_RF_BulkFlashResume_S *)RF_BULK_FLASH_RESUME;
+
+	if ((length == 0) || (length > RF_BULK_FLASH_SIZE)) {
+		return RF_BULK_REFUSE;
+	}
+
+	RF_BulkFlash.token  = token;
+	RF_BulkFlash.length = length;
+	RF_BulkFlash.fill   = 0;
+
+	if ((resume->token == token) && (resume->length == length) && (resume->done <= length)
+			&& ((resume->done % RF_BULK_FLASH_SAVE) == 0)) {
+		RF_BulkFlash.done = resume->done;
+	}
+	else {
+		RF_BulkFlash.done = 0;
+		RF_BulkFlashSave(&resume->done, 0);
+		RF_BulkFlashSave(&resume->length, length);
+		RF_BulkFlashSave(&resume->token, token);
+	}
+
+	/* The chunk holding the first byte not in flash; the part of it
+	 * already programmed is skipped when it arrives again */
+	return RF_BulkFlash.done / RF_BULK_CHUNK_SIZE;
+}
+
+/*
+ * @brief : Take the next in-order chunk
+ * @param : offset - image offset of data
+ * 			data   - chunk
+ * 			len    - chunk length
+ * @retval : int - 0 when stored
+ */
+static int RF_BulkFlashWrite(uint32_t offset, const uint8_t *data, uint8_t len)
+{
+	uint8_t *block = (uint8_t *)RF_BulkFlash.block;
+	uint32_t pos;
+	uint8_t i;
+
+	for (i = 0; i < len; i++) {
+		pos = offset + i;
+		if (pos < (RF_BulkFlash.done + RF_BulkFlash.fill)) {
+			continue;					/* programmed before a resume		*/
+		}
+		if (pos != (RF_BulkFlash.done + RF_BulkFlash.fill)) {
+			return -1;
+		}
+		block[RF_BulkFlash.fill++] = data[i];
+		if ((RF_BulkFlash.fill == RF_BULK_FLASH_BLOCK) && (RF_BulkFlashBlock() != 0)) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * @brief : Program the last partial half-page and check the image CRC
+ * @param : none
+ * @retval : int - 0 when the stored image matches its token
+ */
+static int RF_BulkFlashEnd(void)
+{
+	volatile Handle_RF_BulkFlashResume_S *resume = (volatile Handle_RF_BulkFlashResume_S *)RF_BULK_FLASH_RESUME;
+	uint8_t *block = (uint8_t *)RF_BulkFlash.block;
+
+	if (RF_BulkFlash.fill) {
+		while (RF_BulkFlash.fill < RF_BULK_FLASH_BLOCK) {
+			block[RF_BulkFlash.fill++] = 0;		/* erased flash reads 0		*/
+		}
+		if (RF_BulkFlashBlock() != 0) {
+			return -1;
+		}
+	}
+
+	/* Delivered: a START with the same token begins a new transfer */
+	RF_BulkFlashSave(&resume->token, 0);
+
+	return (RF_BulkCrc32((const uint8_t *)RF_BULK_FLASH_BASE, RF_BulkFlash.length) == RF_BulkFlash.token) ? 0 : -1;
+}
+
+const Handle_RF_BulkSink_S RF_BulkFlashSink = {
+	RF_BulkFlashBegin,
+	RF_BulkFlashWrite,
+	RF_BulkFlashEnd
+};
@@ -0,0 +1,51 @@
+/*
+ * RF_BulkLink.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Bulk.h"
+#include "main.h"
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Send one bulk frame, type and sequence go in the RH headers
+ * @param : flags - FLAGS header
+ * 			id    - ID header
+ * 			data  - payload
+ * 			len   - payload length
+ * @retval : Bool_E - TX status
+ */
+static Bool_E RF_BulkRhSend(uint8_t flags, uint8_t id, const uint8_t *data, uint8_t len)
+{
+	RH_setHeaderFlags(flags);
+	RH_setHeaderId(id);
+	return RH_send(data, len);
+}
+
+/*
+ * @brief : Receive one bulk frame
+ * @param : flags - FLAGS header
+ * 			id    - ID header
+ * 			data  - payload buffer
+ * 			len   - in: buffer size, out: payload length
+ * @retval : Bool_E - True when a frame was received
+ */
+static Bool_E RF_BulkRhRecv(uint8_t *flags, uint8_t *id, uint8_t *data, uint8_t *len)
+{
+	if (RH_recv(data, len) == False) {
+		return False;
+	}
+	*flags = RH_headerFlags();
+	*id    = RH_headerId();
+	return True;
+}
+
+const Handle_RF_BulkLink_S RF_BulkRhLink = {
+	RF_BulkRhSend,
+	RF_BulkRhRecv,
+	HAL_GetTick
+};
@@ -0,0 +1,344 @@
+/*
+ * RF_Log.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Sample logger on a flash ring. Samples are packed into 64 byte
+ *  blocks (one base sample, then up to 11 byte-sized deltas) that are
+ *  written with one half-page program each. The page after the one
+ *  being filled is always erased ahead, so a block never waits for an
+ *  erase and the oldest page is the one given up. RF_LogService() runs
+ *  one flash operation at a time and never waits for it. No HAL calls,
+ *  the flash is a set of callbacks, so the same file runs in the host
+ *  simulation (Tools/rf_log_sim.c).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Log.h"
+#include <string.h>
+
+/* Define --------------------------------------------------------------------*/
+#define RF_LOG_OP_NONE 					0
+#define RF_LOG_OP_ERASE 				1
+#define RF_LOG_OP_PROGRAM 				2
+
+#define RF_LOG_CRC_LEN 					(RF_LOG_BLOCK_SIZE - 4U)
+#define RF_LOG_SEARCH_TRIES 			3		/* torn blocks stepped over	*/
+
+/* Typedef -------------------------------------------------------------------*/
+/* The block must fill a half-page exactly */
+typedef char RF_LogBlockSizeCheck[(sizeof(Handle_RF_LogBlock_S) == RF_LOG_BLOCK_SIZE) ? 1 : -1];
+
+/* Variables -----------------------------------------------------------------*/
+/* zlib CRC-32, one nibble at a time */
+static const uint32_t RF_LogCrcTable[16] = {
+	0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+	0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+	0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+	0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : CRC-32 of a block, the crc field excluded
+ * @param : blk - block
+ * @retval : uint32_t - CRC
+ */
+static uint32_t RF_LogCrc(const Handle_RF_LogBlock_S *blk)
+{
+	const uint8_t *p = (const uint8_t *)blk;
+	uint32_t crc = 0xFFFFFFFFU;
+	uint32_t i;
+
+	for (i = 0; i < RF_LOG_CRC_LEN; i++) {
+		crc = RF_LogCrcTable[(crc ^ p[i]) & 0x0FU] ^ (crc >> 4);
+		crc = RF_LogCrcTable[(crc ^ (p[i] >> 4)) & 0x0FU] ^ (crc >> 4);
+	}
+	return ~crc;
+}
+
+/*
+ * @brief : Header of a block looks like one of ours
+ * @param : blk - block in flash
+ * @retval : 1 when plausible, the CRC is not checked
+ */
+static uint8_t RF_LogHeaderOk(const Handle_RF_LogBlock_S *blk)
+{
+	return (blk->magic == RF_LOG_MAGIC) && (blk->seq != 0) &&
+		   (blk->count != 0) && (blk->count <= RF_LOG_SAMPLES);
+}
+
+/*
+ * @brief : Flash area reads erased (0 on the L0)
+ * @param : log    - logger
+ * 			offset - start, word aligned
+ * 			len    - bytes
+ * @retval : 1 when every word is 0
+ */
+static uint8_t RF_LogErased(Handle_RF_Log_S *log, uint32_t offset, uint32_t len)
+{
+	const uint32_t *w = (const uint32_t *)(log->flash->mem + offset);
+	uint32_t i;
+
+	for (i = 0; i < (len / 4U); i++) {
+		log->scanWords++;
+		if (w[i] != 0) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * @brief : Seal the block being built and queue it for flash
+ * @param : log - logger
+ * @retval : none
+ */
+static void RF_LogClose(Handle_RF_Log_S *log)
+{
+	Handle_RF_LogBlock_S *blk = &log->build;
+
+	if (blk->count == 0) {
+		return;
+	}
+
+	if (log->qCount == RF_LOG_QUEUE) {
+		log->dropped += blk->count;
+	}
+	else {
+		blk->seq 	= log->seq++;
+		blk->magic 	= RF_LOG_MAGIC;
+		blk->crc 	= RF_LogCrc(blk);
+		log->queue[(log->qHead + log->qCount) % RF_LOG_QUEUE] = *blk;
+		log->qCount++;
+	}
+
+	memset(blk, 0, sizeof(*blk));
+}
+
+/*
+ * @brief : Find the newest block and the write position after a reset.
+ * 			Only the headers are read, plus the CRC of the newest one;
+ * 			a block torn by the reset fails it and the search goes on
+ * 			below its sequence number.
+ * @param : log   - logger
+ * 			flash - flash region, at least three pages
+ * @retval : none
+ */
+void RF_LogInit(Handle_RF_Log_S *log, const Handle_RF_LogFlash_S *flash)
+{
+	const Handle_RF_LogBlock_S *blk;
+	uint32_t limit = 0xFFFFFFFFU;
+	uint32_t best = 0, bestSeq = 0, offset, rest;
+	uint8_t tries;
+
+	memset(log, 0, sizeof(*log));
+	log->flash = flash;
+
+	for (tries = 0; tries < RF_LOG_SEARCH_TRIES; tries++) {
+		bestSeq = 0;
+		log->recovered = 0;
+		for (offset = 0; offset < flash->size; offset += RF_LOG_BLOCK_SIZE) {
+			blk = (const Handle_RF_LogBlock_S *)(flash->mem + offset);
+			log->scanWords += 2U;
+			if (RF_LogHeaderOk(blk) && (blk->seq < limit)) {
+				log->recovered++;
+				if (blk->seq > bestSeq) {
+					bestSeq = blk->seq;
+					best 	= offset;
+				}
+			}
+		}
+
+		if (bestSeq == 0) {
+			break;
+		}
+		log->scanWords += RF_LOG_BLOCK_SIZE / 4U;
+		if (RF_LogCrc((const Handle_RF_LogBlock_S *)(flash->mem + best)) ==
+			((const Handle_RF_LogBlock_S *)(flash->mem + best))->crc) {
+			break;
+		}
+		log->skipped++;
+		limit 	= bestSeq;
+		bestSeq = 0;
+	}
+
+	/* Out of tries: start over at 0 but keep the numbers increasing */
+	log->seq  = ((bestSeq != 0) ? bestSeq : ((limit != 0xFFFFFFFFU) ? limit : 0U)) + 1U;
+	log->head = (bestSeq != 0) ? ((best + RF_LOG_BLOCK_SIZE) % flash->size) : 0;
+
+	/* Step over a torn block in the current page; a page that is not
+	   erased from its start is erased again by RF_LogService() */
+	for (;;) {
+		rest = RF_LOG_PAGE_SIZE - (log->head % RF_LOG_PAGE_SIZE);
+		if (RF_LogErased(log, log->head, rest)) {
+			log->ahead = rest;
+			break;
+		}
+		if ((log->head % RF_LOG_PAGE_SIZE) == 0) {
+			log->ahead = 0;
+			break;
+		}
+		log->skipped++;
+		log->head = (log->head + RF_LOG_BLOCK_SIZE) % flash->size;
+	}
+
+	if ((log->ahead != 0) &&
+		RF_LogErased(log, (log->head + log->ahead) % flash->size, RF_LOG_PAGE_SIZE)) {
+		log->ahead += RF_LOG_PAGE_SIZE;
+	}
+}
+
+/*
+ * @brief : Add a sample. Main loop context only, not from an interrupt.
+ * @param : log    - logger
+ * 			ms     - sample time
+ * 			values - RF_LOG_CHANNELS values
+ * @retval : none
+ */
+void RF_LogAppend(Handle_RF_Log_S *log, uint32_t ms, const int16_t *values)
+{
+	Handle_RF_LogBlock_S *blk = &log->build;
+	Handle_RF_LogDelta_S *delta;
+	int32_t d[RF_LOG_CHANNELS];
+	uint32_t dt, c;
+	uint8_t fits;
+
+	log->samples++;
+
+	if (blk->count != 0) {
+		dt 	 = (ms - log->lastTime + (RF_LOG_DT_UNIT_MS / 2U)) / RF_LOG_DT_UNIT_MS;
+		fits = (dt <= 0xFFU);
+		for (c = 0; c < RF_LOG_CHANNELS; c++) {
+			d[c] = (int32_t)values[c] - log->last[c];
+			fits &= (d[c] >= -128) && (d[c] <= 127);
+		}
+
+		if (fits) {
+			delta = &blk->delta[blk->count - 1U];
+			delta->dt = (uint8_t)dt;
+			for (c = 0; c < RF_LOG_CHANNELS; c++) {
+				delta->d[c] = (int8_t)d[c];
+				log->last[c] = values[c];
+			}
+			log->lastTime += dt * RF_LOG_DT_UNIT_MS;
+
+			if (++blk->count == RF_LOG_SAMPLES) {
+				RF_LogClose(log);
+			}
+			return;
+		}
+		RF_LogClose(log);
+	}
+
+	blk->time 	  = ms;
+	blk->count 	  = 1;
+	log->lastTime = ms;
+	for (c = 0; c < RF_LOG_CHANNELS; c++) {
+		blk->base[c] = values[c];
+		log->last[c] = values[c];
+	}
+}
+
+/*
+ * @brief : Queue the partly filled block, e.g. before a planned reset
+ * @param : log - logger
+ * @retval : none
+ */
+void RF_LogFlush(Handle_RF_Log_S *log)
+{
+	RF_LogClose(log);
+}
+
+/*
+ * @brief : Start the next flash operation once the last one is done.
+ * 			Erasing ahead comes first, then queued blocks. Call from the
+ * 			main loop as often as convenient.
+ * @param : log - logger
+ * @retval : 1 while flash work is pending or running, 0 when idle
+ */
+uint8_t RF_LogService(Handle_RF_Log_S *log)
+{
+	const Handle_RF_LogFlash_S *flash = log->flash;
+	int status = flash->status();
+
+	if (status > 0) {
+		return 1;
+	}
+
+	if (log->op != RF_LOG_OP_NONE) {
+		if (status < 0) {
+			log->errors++;
+			if (log->op == RF_LOG_OP_ERASE) {
+				log->ahead -= RF_LOG_PAGE_SIZE;		/* erase it again		*/
+			}
+		}
+		log->op = RF_LOG_OP_NONE;
+	}
+
+	/* Keep the rest of this page and all of the next one erased */
+	if (log->ahead < ((RF_LOG_PAGE_SIZE - (log->head % RF_LOG_PAGE_SIZE)) + RF_LOG_PAGE_SIZE)) {
+		flash->erase((log->head + log->ahead) % flash->size);
+		log->ahead += RF_LOG_PAGE_SIZE;
+		log->erases++;
+		log->op = RF_LOG_OP_ERASE;
+		return 1;
+	}
+
+	if (log->qCount != 0) {
+		flash->program(log->head, (const uint32_t *)&log->queue[log->qHead]);
+		log->qHead 	= (uint8_t)((log->qHead + 1U) % RF_LOG_QUEUE);
+		log->qCount--;
+		log->head 	= (log->head + RF_LOG_BLOCK_SIZE) % flash->size;
+		log->ahead -= RF_LOG_BLOCK_SIZE;
+		log->blocks++;
+		log->op = RF_LOG_OP_PROGRAM;
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * @brief : Committed block at an offset of the ring
+ * @param : log    - logger
+ * 			offset - block offset
+ * @retval : block in flash, NULL when erased, torn or foreign
+ */
+const Handle_RF_LogBlock_S *RF_LogBlock(const Handle_RF_Log_S *log, uint32_t offset)
+{
+	const Handle_RF_LogBlock_S *blk = (const Handle_RF_LogBlock_S *)(log->flash->mem + offset);
+
+	if (!RF_LogHeaderOk(blk) || (RF_LogCrc(blk) != blk->crc)) {
+		return NULL;
+	}
+	return blk;
+}
+
+/*
+ * @brief : Expand a block into samples
+ * @param : blk    - committed block
+ * 			times  - RF_LOG_SAMPLES entries, ms
+ * 			values - RF_LOG_SAMPLES rows
+ * @retval : uint8_t - samples written
+ */
+uint8_t RF_LogDecode(const Handle_RF_LogBlock_S *blk, uint32_t *times, int16_t (*values)[RF_LOG_CHANNELS])
+{
+	uint32_t c;
+	uint8_t i;
+
+	times[0] = blk->time;
+	for (c = 0; c < RF_LOG_CHANNELS; c++) {
+		values[0][c] = blk->base[c];
+	}
+
+	for (i = 1; i < blk->count; i++) {
+		times[i] = times[i - 1U] + ((uint32_t)blk->delta[i - 1U].dt * RF_LOG_DT_UNIT_MS);
+		for (c = 0; c < RF_LOG_CHANNELS; c++) {
+			values[i][c] = (int16_t)(values[i - 1U][c] + blk->delta[i - 1U].d[c]);
+		}
+	}
+	return blk->count;
+}
@@ -0,0 +1,174 @@
+/*
+ * RF_LogFlash.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  RF_Log on the STM32L073 program flash. The region is the top of
+ *  bank 2 (LOG in the linker script); the code runs from bank 1, so it
+ *  keeps executing while a page erase or half-page program runs
+ *  (read-while-write) and nothing here waits on BSY.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Log.h"
+#include "main.h"
+#include <stdio.h>
+
+/* Define --------------------------------------------------------------------*/
+#define RF_LOG_FLASH_BASE 				0x0802C000UL	/* LOG region in the .ld	*/
+#define RF_LOG_FLASH_SIZE 				(16U * 1024U)
+
+#define RF_LOG_FLASH_ERRORS 			(FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_SIZERR | \
+										 FLASH_SR_OPTVERR | FLASH_SR_RDERR | FLASH_SR_NOTZEROERR | \
+										 FLASH_SR_FWWERR)
+#define RF_LOG_FLASH_OPS 				(FLASH_PECR_ERASE | FLASH_PECR_PROG | FLASH_PECR_FPRG)
+
+#define RF_LOG_BENCH_SAMPLES 			6000U
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : State of the last erase or program
+ * @param : none
+ * @retval : int - 1 busy, 0 done, -1 failed
+ */
+static int RF_LogStmStatus(void)
+{
+	uint32_t sr = FLASH->SR;
+
+	if (sr & FLASH_SR_BSY) {
+		return 1;
+	}
+
+	if (FLASH->PECR & RF_LOG_FLASH_OPS) {
+		CLEAR_BIT(FLASH->PECR, RF_LOG_FLASH_OPS);
+		HAL_FLASH_Lock();
+		if (sr & RF_LOG_FLASH_ERRORS) {
+			__HAL_FLASH_CLEAR_FLAG(RF_LOG_FLASH_ERRORS);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * @brief : Start a page erase: ERASE + PROG, then a write of 0 in the page
+ * @param : offset - page offset in the region
+ * @retval : none
+ */
+static RAMFUNC void RF_LogStmErase(uint32_t offset)
+{
+	HAL_FLASH_Unlock();
+	__HAL_FLASH_CLEAR_FLAG(RF_LOG_FLASH_ERRORS);
+
+	SET_BIT(FLASH->PECR, FLASH_PECR_ERASE | FLASH_PECR_PROG);
+	*(__IO uint32_t *)(RF_LOG_FLASH_BASE + offset) = 0;
+}
+
+/*
+ * @brief : Start a half-page program. The 16 word burst must not be
+ * 			interrupted by a flash access, as in HAL_FLASHEx_HalfPageProgram(),
+ * 			but the ~3 ms of programming after it is not waited for.
+ * @param : offset - half-page offset in the region
+ * 			words  - 16 words
+ * @retval : none
+ */
+static RAMFUNC void RF_LogStmProgram(uint32_t offset, const uint32_t *words)
+{
+	__IO uint32_t *dest = (__IO uint32_t *)(RF_LOG_FLASH_BASE + offset);
+	uint32_t primask;
+	uint8_t i;
+
+	HAL_FLASH_Unlock();
+	__HAL_FLASH_CLEAR_FLAG(RF_LOG_FLASH_ERRORS);
+
+	SET_BIT(FLASH->PECR, FLASH_PECR_FPRG | FLASH_PECR_PROG);
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for (i = 0; i < (RF_LOG_BLOCK_SIZE / 4U); i++) {
+		*dest = words[i];				/* address is not increased		*/
+	}
+	__set_PRIMASK(primask);
+}
+
+const Handle_RF_LogFlash_S RF_LogStmFlash = {
+	(const uint8_t *)RF_LOG_FLASH_BASE,
+	RF_LOG_FLASH_SIZE,
+	RF_LogStmStatus,
+	RF_LogStmErase,
+	RF_LogStmProgram
+};
+
+/*
+ * @brief : Microseconds since boot, from the HAL tick and SysTick
+ * @param : none
+ * @retval : uint32_t - us
+ */
+static uint32_t RF_LogMicros(void)
+{
+	uint32_t ms, val;
+
+	do {
+		ms 	= HAL_GetTick();
+		val = SysTick->VAL;
+	} while (ms != HAL_GetTick());
+
+	return (ms * 1000U) + (((SysTick->LOAD - val) * 1000U) / (SysTick->LOAD + 1U));
+}
+
+/*
+ * @brief : Recover the log after a reset and time it
+ * @param : log - logger
+ * @retval : uint32_t - recovery time, us
+ */
+uint32_t RF_LogStart(Handle_RF_Log_S *log)
+{
+	uint32_t start = RF_LogMicros();
+
+	RF_LogInit(log, &RF_LogStmFlash);
+	return RF_LogMicros() - start;
+}
+
+#if RF_LOG_BENCH
+/*
+ * @brief : Log RF_LOG_BENCH_SAMPLES samples as fast as the flash takes
+ * 			them, then recover the log as after a reset, and print both.
+ * 			The samples are a slow ramp, so every block holds 12.
+ * @param : log - logger, started
+ * @retval : none
+ */
+void RF_LogBench(Handle_RF_Log_S *log)
+{
+	int16_t v[RF_LOG_CHANNELS] = {0};
+	uint32_t start, elapsed, blocks, i = 0;
+
+	start  = HAL_GetTick();
+	blocks = log->blocks;
+	while (i < RF_LOG_BENCH_SAMPLES) {
+		if (log->qCount < RF_LOG_QUEUE) {
+			v[0]++;
+			v[1] = (int16_t)(v[0] / 4);
+			v[2] = (int16_t)(i & 0x3F);
+			RF_LogAppend(log, start + (i * RF_LOG_DT_UNIT_MS), v);
+			i++;
+		}
+		RF_LogService(log);
+	}
+	while (log->qCount == RF_LOG_QUEUE) {
+		RF_LogService(log);
+	}
+	RF_LogFlush(log);
+	while (RF_LogService(log)) {
+	}
+	elapsed = HAL_GetTick() - start;
+	blocks  = log->blocks - blocks;
+
+	printf("Log bench: %lu samples, %lu blocks in %lu ms, %lu samples/s, %lu B/s, %lu erases\r",
+			i, blocks, elapsed, (i * 1000U) / elapsed,
+			(blocks * RF_LOG_BLOCK_SIZE * 1000U) / elapsed, log->erases);
+	printf("Log bench: recovery %lu us, %lu blocks, %lu words read\r",
+			RF_LogStart(log), log->recovered, log->scanWords);
+}
+#endif
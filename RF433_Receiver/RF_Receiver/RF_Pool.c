@@ -0,0 +1,150 @@
+/*
+ * RF_Pool.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Fixed-block allocator for frame buffers and queues. Each size class
+ *  is a singly linked free list through its own blocks, so allocate and
+ *  free are a pointer swap with interrupts masked; a request takes the
+ *  smallest class that fits and steps up while a class is empty, at most
+ *  RF_POOL_CLASSES checks. Blocks never split or merge, so there is no
+ *  fragmentation and the worst case is known at link time.
+ *
+ *  The classes are carved from the .pool region (_spool.._epool) in the
+ *  linker script. RF_PoolInit() also seals the newlib heap: a later
+ *  _sbrk() call stops in Error_Handler() instead of eating the stack.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Pool.h"
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	uint16_t 	size;
+	uint16_t 	count;
+
+}Handle_RF_PoolCfg_S;
+
+/* Variables -----------------------------------------------------------------*/
+Handle_RF_Pool_S RF_Pool[RF_POOL_CLASSES];
+
+static const Handle_RF_PoolCfg_S poolCfg[RF_POOL_CLASSES] = RF_POOL_CLASS_TABLE;
+
+extern uint8_t _spool;					/* linker script				*/
+extern uint8_t _epool;
+extern uint8_t sbrkSealed;				/* sysmem.c						*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Carve the pool region into the size classes and seal the heap.
+ * 			Call once, after the first printf() (newlib allocates the
+ * 			stdout buffer on first use).
+ * @param : none
+ * @retval : none
+ */
+void RF_PoolInit(void)
+{
+	uint8_t *next = &_spool;
+	uint32_t c, i;
+
+	for (c = 0; c < RF_POOL_CLASSES; c++) {
+		Handle_RF_Pool_S *pool = &RF_Pool[c];
+
+		pool->size      = (uint16_t)((poolCfg[c].size + 3U) & ~3U);
+		pool->count     = poolCfg[c].count;
+		pool->inUse     = 0;
+		pool->highWater = 0;
+		pool->fails     = 0;
+		pool->base      = next;
+		pool->limit     = next + ((uint32_t)pool->size * pool->count);
+		pool->free      = NULL;
+
+		if (pool->limit > &_epool) {
+			/* RF_POOL_CLASS_TABLE does not fit _Pool_Size */
+			Error_Handler();
+		}
+
+		/* Lowest address ends up at the head */
+		for (i = pool->count; i > 0U; i--) {
+			void **block = (void **)(pool->base + ((i - 1U) * pool->size));
+
+			*block = pool->free;
+			pool->free = block;
+		}
+		next = pool->limit;
+	}
+
+	sbrkSealed = 1;
+}
+
+/*
+ * @brief : Take a block of at least size bytes; any context.
+ * @param : size - bytes needed
+ * @retval : block, NULL when it is larger than the largest class or
+ * 			 every class that fits is empty
+ */
+void *RF_PoolAlloc(uint16_t size)
+{
+	uint32_t primask, c;
+	void **block = NULL;
+
+	for (c = 0; (c < RF_POOL_CLASSES) && (RF_Pool[c].size < size); c++) {
+	}
+	if (c == RF_POOL_CLASSES) {
+		return NULL;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for (; c < RF_POOL_CLASSES; c++) {
+		Handle_RF_Pool_S *pool = &RF_Pool[c];
+
+		if (pool->free != NULL) {
+			block = (void **)pool->free;
+			pool->free = *block;
+			if (++pool->inUse > pool->highWater) {
+				pool->highWater = pool->inUse;
+			}
+			break;
+		}
+		pool->fails++;
+	}
+	__set_PRIMASK(primask);
+
+	return block;
+}
+
+/*
+ * @brief : Give a block back; any context. NULL is ignored, a pointer
+ * 			that is not a block start stops in Error_Handler().
+ * @param : block - from RF_PoolAlloc()
+ * @retval : none
+ */
+void RF_PoolFree(void *block)
+{
+	uint8_t *p = (uint8_t *)block;
+	uint32_t primask, c;
+
+	if (block == NULL) {
+		return;
+	}
+	for (c = 0; c < RF_POOL_CLASSES; c++) {
+		if ((p >= RF_Pool[c].base) && (p < RF_Pool[c].limit)) {
+			break;
+		}
+	}
+	if ((c == RF_POOL_CLASSES) || (((uint32_t)(p - RF_Pool[c].base) % RF_Pool[c].size) != 0U)) {
+		Error_Handler();
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*(void **)block = RF_Pool[c].free;
+	RF_Pool[c].free = block;
+	RF_Pool[c].inUse--;
+	__set_PRIMASK(primask);
+}
+
+/*********************************END OF FILE**********************************/
@@ -0,0 +1,63 @@
+/*
+ * RF_ResetLog.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Keeps the watchdog record of the last supervised reset in data
+ *  EEPROM. The copy is written once per supervised reset, at boot and
+ *  before the IWDG starts (~3 ms a word). The magic is cleared first and
+ *  written last, so a copy torn by a power loss reads as no record.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_ResetLog.h"
+
+/* Define --------------------------------------------------------------------*/
+#define RF_RESET_LOG_WORDS 				(sizeof(Handle_Wdg_Record_S) / 4U)
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Program one EEPROM word, skipped when it already holds the value
+ * @param : field - word in the EEPROM record
+ * 			value - new value
+ * @retval : none
+ */
+static void RF_ResetLogSave(volatile uint32_t *field, uint32_t value)
+{
+	if (*field == value) {
+		return;
+	}
+	HAL_FLASHEx_DATAEEPROM_Unlock();
+	HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAM_WORD, (uint32_t)field, value);
+	HAL_FLASHEx_DATAEEPROM_Lock();
+}
+
+/*
+ * @brief : Store the previous run's watchdog record, if there is one, and
+ * 			return the newest stored one
+ * @param : last - Wdg_Init() result, NULL after a reset it did not cause
+ * @retval : const Handle_RF_ResetLog_S * - stored record, NULL if none yet
+ */
+const Handle_RF_ResetLog_S *RF_ResetLogInit(const Handle_Wdg_Record_S *last)
+{
+	volatile Handle_RF_ResetLog_S *log = (volatile Handle_RF_ResetLog_S *)RF_RESET_LOG_ADDRESS;
+	volatile uint32_t *dst = (volatile uint32_t *)&log->last;
+	const uint32_t *src = (const uint32_t *)last;
+	uint32_t total = 0, i;
+
+	if (last != NULL) {
+		if (log->magic == RF_RESET_LOG_MAGIC) {
+			total = log->total;
+		}
+		RF_ResetLogSave(&log->magic, 0);
+		for (i = 0; i < RF_RESET_LOG_WORDS; i++) {
+			RF_ResetLogSave(&dst[i], src[i]);
+		}
+		RF_ResetLogSave(&log->total, total + 1U);
+		RF_ResetLogSave(&log->magic, RF_RESET_LOG_MAGIC);
+	}
+
+	return (log->magic == RF_RESET_LOG_MAGIC) ? (const Handle_RF_ResetLog_S *)log : NULL;
+}
@@ -0,0 +1,73 @@
+/*
+ * RF_Trace.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Deferred-format trace. A call site stores the ID of its format
+ *  string and the raw arguments, a handful of stores with interrupts
+ *  masked, so RF_TRACE() can sit in the RH_ASK tick without moving its
+ *  timing. The main loop sends the records as hex lines starting with
+ *  '~' through the Console; Tools/trace_decode.py expands them on the
+ *  host with the format strings taken from the ELF.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "RF_Trace.h"
+#include "Console.h"
+
+/* Variables -----------------------------------------------------------------*/
+Handle_RF_Trace_S RF_Trace = {0};
+
+static const char hexDigit[] = "0123456789abcdef";
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Send up to RF_TRACE_DRAIN_MAX records to the console.
+ * 			Main loop only; a record is ~10 to 46 characters on the wire.
+ * 			A record stays in the ring until the console has room for
+ * 			its whole line; a line cut short anyway (an interrupt wrote
+ * 			in between) is counted in RF_Trace.dropped.
+ * @param : none
+ * @retval : none
+ */
+void RF_TraceDrain(void)
+{
+	char line[2U + (5U * 9U) + 2U];
+	uint32_t tail = RF_Trace.tail;
+	uint32_t count, word, n, i, primask;
+	uint8_t pos, d;
+
+	for (count = 0; (count < RF_TRACE_DRAIN_MAX) && (tail != RF_Trace.head); count++) {
+		n = ((RF_Trace.ring[tail & (RF_TRACE_WORDS - 1U)] >> 13) & 0x7U) + 1U;
+		pos = 0;
+		line[pos++] = '~';
+		for (i = 0; i < n; i++) {
+			word = RF_Trace.ring[(tail + i) & (RF_TRACE_WORDS - 1U)];
+			line[pos++] = ' ';
+			for (d = 0; d < 8U; d++) {
+				line[pos++] = hexDigit[(word >> (28U - (4U * d))) & 0xFU];
+			}
+		}
+		line[pos++] = '\r';
+		line[pos++] = '\n';
+
+		if (Console_Free() < pos) {
+			break;
+		}
+		if (Console_Write(line, pos) != pos) {
+			/* RF_TraceEmit() counts drops from interrupts as well */
+			primask = __get_PRIMASK();
+			__disable_irq();
+			RF_Trace.dropped++;
+			__set_PRIMASK(primask);
+		}
+
+		/* Space is only handed back once the record has been copied */
+		tail += n;
+		RF_Trace.tail = tail;
+	}
+}
+
+/*********************************END OF FILE**********************************/
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+delta_diff.py
+
+Make (or apply) a copy/add patch for the A/B slot images, the format
+read by Boot/Boot_Delta.c:
+
+    python3 Tools/delta_diff.py diff  old.bin new.bin patch.dlt
+    python3 Tools/delta_diff.py apply old.bin patch.dlt out.bin
+
+Header: "DLT1", old slot CRC, new length, new slot CRC (4 x u32 LE).
+Ops:    0x01 COPY varint len, zigzag varint (old offset - end of last COPY)
+        0x02 ADD  varint len, literal bytes
+        0x00 END
+Both images must be signed (Tools/slot_sign.py): the device only
+applies a patch to the exact base image whose slot CRC it names.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import struct
+import sys
+
+MAGIC = 0x31544C44
+OP_END, OP_COPY, OP_ADD = 0x00, 0x01, 0x02
+SLOT_CRC_OFFSET = 0xC0 + 12
+
+KMER = 8            # index granularity
+MIN_COPY = 8        # a COPY costs ~3-6 bytes; shorter matches go into ADD
+MAX_CANDIDATES = 16
+
+
+def varint(n):
+    out = bytearray()
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        if n:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def zigzag(n):
+    return (n << 1) if n >= 0 else ((-n) << 1) - 1
+
+
+def unzigzag(n):
+    return (n >> 1) ^ -(n & 1)
+
+
+def slot_crc(image):
+    if len(image) < SLOT_CRC_OFFSET + 4:
+        return 0
+    return struct.unpack_from("<I", image, SLOT_CRC_OFFSET)[0]
+
+
+def match_len(old, o, new, n):
+    limit = min(len(old) - o, len(new) - n)
+    i = 0
+    while i < limit and old[o + i] == new[n + i]:
+        i += 1
+    return i
+
+
+def diff(old, new):
+    index = {}
+    for i in range(len(old) - KMER + 1):
+        bucket = index.setdefault(old[i:i + KMER], [])
+        if len(bucket) < MAX_CANDIDATES:
+            bucket.append(i)
+
+    out = bytearray(struct.pack("<IIII", MAGIC, slot_crc(old), len(new), slot_crc(new)))
+    literal = bytearray()
+    old_pos = 0         # end of the previous COPY, as on the device
+    n = 0
+
+    def flush():
+        if literal:
+            out.append(OP_ADD)
+            out.extend(varint(len(literal)))
+            out.extend(literal)
+            literal.clear()
+
+    while n < len(new):
+        # Continuing where the last copy stopped is the cheapest COPY
+        best_off, best_len = old_pos, match_len(old, old_pos, new, n) if old_pos < len(old) else 0
+        for cand in index.get(bytes(new[n:n + KMER]), ()):
+            length = match_len(old, cand, new, n)
+            if length > best_len:
+                best_off, best_len = cand, length
+
+        if best_len >= MIN_COPY:
+            flush()
+            out.append(OP_COPY)
+            out.extend(varint(best_len))
+            out.extend(varint(zigzag(best_off - old_pos)))
+            old_pos = best_off + best_len
+            n += best_len
+        else:
+            literal.append(new[n])
+            n += 1
+
+    flush()
+    out.append(OP_END)
+    return bytes(out)
+
+
+def apply(old, patch):
+    magic, old_crc, new_len, _ = struct.unpack_from("<IIII", patch)
+    if magic != MAGIC:
+        raise ValueError("not a DLT1 patch")
+    if old_crc != slot_crc(old):
+        raise ValueError("patch was made for another base image")
+
+    def read_varint(p):
+        value = shift = 0
+        while True:
+            b = patch[p]
+            p += 1
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return value, p
+
+    new = bytearray()
+    old_pos = 0
+    p = 16
+    while True:
+        op = patch[p]
+        p += 1
+        if op == OP_END:
+            break
+        length, p = read_varint(p)
+        if op == OP_COPY:
+            delta, p = read_varint(p)
+            old_pos += unzigzag(delta)
+            new += old[old_pos:old_pos + length]
+            old_pos += length
+        elif op == OP_ADD:
+            new += patch[p:p + length]
+            p += length
+        else:
+            raise ValueError("bad op 0x%02X at %u" % (op, p - 1))
+    if len(new) != new_len:
+        raise ValueError("patch produced %u bytes, header says %u" % (len(new), new_len))
+    return bytes(new)
+
+
+def main():
+    if len(sys.argv) != 5 or sys.argv[1] not in ("diff", "apply"):
+        sys.exit(__doc__)
+
+    a = open(sys.argv[2], "rb").read()
+    b = open(sys.argv[3], "rb").read()
+    if sys.argv[1] == "diff":
+        result = diff(a, b)
+        print("%u -> %u bytes, patch %u bytes (%.1f%%)"
+              % (len(a), len(b), len(result), 100.0 * len(result) / max(len(b), 1)))
+    else:
+        result = apply(a, b)
+    open(sys.argv[4], "wb").write(result)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,142 @@
+/*
+ * delta_host.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Runs the device patch applier (Common/Boot/Boot_Delta.c) on the host:
+ *
+ *  gcc -O2 -Wall -I../Common/Boot/Inc delta_host.c ../Common/Boot/Boot_Delta.c -o delta_host
+ *  ./delta_host old.bin patch.dlt out.bin [feed size] [step]
+ *
+ *  The patch is fed in pieces of <feed size> bytes (default 60, one
+ *  RH_ASK payload) the way a radio or UART transport would deliver it.
+ *  With a step each piece is applied by Boot_DeltaStep() at most <step>
+ *  output bytes at a time, as Boot_Update.c does (BOOT_UPD_DELTA_STEP).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Boot_Delta.h"
+
+/* Define --------------------------------------------------------------------*/
+#define HOST_MAX_IMAGE 					(192U * 1024U)
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t  newImage[HOST_MAX_IMAGE];
+static uint32_t newEnd = 0;
+static uint32_t blocks = 0;
+
+/* Function prototypes -------------------------------------------------------*/
+
+static uint8_t *Host_Load(const char *path, uint32_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *buf;
+	long size;
+
+	if (f == NULL) {
+		perror(path);
+		exit(2);
+	}
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	buf = malloc((size_t)size + 1U);
+	if ((buf == NULL) || (fread(buf, 1, (size_t)size, f) != (size_t)size)) {
+		fprintf(stderr, "%s: read error\n", path);
+		exit(2);
+	}
+	fclose(f);
+	*len = (uint32_t)size;
+	return buf;
+}
+
+/* Stands in for page erase + half-page program */
+static int Host_Write(uint32_t offset, const uint32_t *block)
+{
+	if ((offset % BOOT_DELTA_BLOCK_SIZE) || ((offset + BOOT_DELTA_BLOCK_SIZE) > HOST_MAX_IMAGE)) {
+		return -1;
+	}
+	memcpy(&newImage[offset], block, BOOT_DELTA_BLOCK_SIZE);
+	if ((offset + BOOT_DELTA_BLOCK_SIZE) > newEnd) {
+		newEnd = offset + BOOT_DELTA_BLOCK_SIZE;
+	}
+	blocks++;
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	Handle_Boot_Delta_S delta;
+	Handle_Boot_DeltaStatus_E status = BootDeltaOk;
+	uint32_t oldLen, patchLen, oldCrc = 0, feed = 60, step = 0, used;
+	uint8_t *oldImage, *patch;
+	FILE *out;
+
+	if (argc < 4) {
+		fprintf(stderr, "usage: %s old.bin patch.dlt out.bin [feed size] [step]\n", argv[0]);
+		return 2;
+	}
+	if (argc > 4) {
+		feed = (uint32_t)strtoul(argv[4], NULL, 0);
+	}
+	if (argc > 5) {
+		step = (uint32_t)strtoul(argv[5], NULL, 0);
+	}
+
+	oldImage = Host_Load(argv[1], &oldLen);
+	patch = Host_Load(argv[2], &patchLen);
+
+	/* Slot header CRC of the base image, as Upd_BeginDelta() passes it */
+	if (oldLen >= 0xD0U) {
+		memcpy(&oldCrc, &oldImage[0xCC], 4);
+	}
+
+	Boot_DeltaBegin(&delta, oldImage, oldLen, oldCrc, Host_Write);
+
+	for (uint32_t pos = 0; pos < patchLen; pos += feed) {
+		uint32_t n = ((patchLen - pos) < feed) ? (patchLen - pos) : feed;
+
+		if (step == 0) {
+			status = Boot_DeltaFeed(&delta, &patch[pos], n);
+		}
+		else {
+			/* one service call per step, until the piece is used up */
+			for (uint32_t p = 0; ; p += used) {
+				status = Boot_DeltaStep(&delta, &patch[pos + p], n - p, step, &used);
+				if ((status != BootDeltaOk) || (((p + used) == n) && !Boot_DeltaCopying(&delta))) {
+					break;
+				}
+			}
+		}
+		if ((status != BootDeltaOk) && (status != BootDeltaDone)) {
+			break;
+		}
+	}
+
+	if ((status == BootDeltaOk) || (status == BootDeltaDone)) {
+		status = Boot_DeltaEnd(&delta);
+	}
+	if (status != BootDeltaDone) {
+		fprintf(stderr, "apply failed: status %d at output %u\n", (int)status, (unsigned)delta.outPos);
+		return 1;
+	}
+
+	out = fopen(argv[3], "wb");
+	if (out == NULL) {
+		perror(argv[3]);
+		return 2;
+	}
+	fwrite(newImage, 1, delta.newLength, out);
+	fclose(out);
+
+	printf("applied %u byte patch: %u bytes, %u blocks, applier state %u bytes\n",
+			(unsigned)patchLen, (unsigned)delta.newLength, (unsigned)blocks, (unsigned)sizeof(delta));
+
+	free(oldImage);
+	free(patch);
+	return 0;
+}
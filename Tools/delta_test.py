@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+delta_test.py
+
+Round-trip test for the delta updater: for every old/new .bin pair,
+make a patch with delta_diff.py, apply it with the Python reference and
+with the device applier (Common/Boot/Boot_Delta.c built for the host
+via delta_host.c), and check both rebuild the new image byte for byte.
+
+    python3 Tools/delta_test.py old1.bin new1.bin [old2.bin new2.bin ...]
+
+Without arguments it runs every NAME_old.bin / NAME_new.bin pair in
+Tools/delta_pairs, then pairs derived from the RL78 build in
+LCD_TEST/DefaultBuild/LCD_TEST.mot (code inserted mid-image, scattered
+constant changes, unchanged image).
+
+Tools/delta_pairs holds two real builds per pair, so the patch sees
+what a compiler does to an image after a source change (calls and
+literals shifted, not random bytes):
+
+    lcd_sim_rowfix   .text of LCD_TEST/Sim (LCD1602.c under the HD44780
+                     model), host gcc -O2, before and after the
+                     lcd_bar_graph() row check
+    lcd_sim_review   the same, from the glyph cache rework to the row
+                     check (NULL %s guard in between)
+
+No Cortex-M0+ or RL78 compiler runs here, hence host builds; drop a
+pair of signed STM32 slot images in as NAME_old.bin / NAME_new.bin and
+it is picked up as well.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+import delta_diff
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+BOOT = os.path.join(ROOT, "Common", "Boot")
+PAIRS = os.path.join(HERE, "delta_pairs")
+# (feed size, output step): step 0 applies each piece in one call
+FEEDS = ((1, 0), (60, 0), (256, 0), (256, 1024), (60, 64))
+
+
+def srec_to_bin(path, limit=0x70000):
+    """Code flash part of an S-record file (the data flash area is dropped)."""
+    mem = {}
+    for line in open(path):
+        line = line.strip()
+        if not line.startswith("S") or line[1] not in "123":
+            continue
+        alen = {"1": 2, "2": 3, "3": 4}[line[1]]
+        raw = bytes.fromhex(line[2:])
+        addr = int.from_bytes(raw[1:1 + alen], "big")
+        if addr >= limit:
+            continue
+        for i, b in enumerate(raw[1 + alen:-1]):
+            mem[addr + i] = b
+    lo, hi = min(mem), max(mem) + 1
+    return bytes(mem.get(a, 0xFF) for a in range(lo, hi))
+
+
+def build_pairs():
+    """Real old/new builds from Tools/delta_pairs, by name."""
+    pairs = []
+    for f in sorted(os.listdir(PAIRS)):
+        if not f.endswith("_old.bin"):
+            continue
+        name = f[:-len("_old.bin")]
+        new = os.path.join(PAIRS, name + "_new.bin")
+        if os.path.exists(new):
+            pairs.append((name, open(os.path.join(PAIRS, f), "rb").read(), open(new, "rb").read()))
+    return pairs
+
+
+def derived_pairs():
+    base = srec_to_bin(os.path.join(ROOT, "LCD_TEST", "DefaultBuild", "LCD_TEST.mot"))
+    rng = random.Random(1)
+
+    grown = bytearray(base)
+    at = len(base) // 3
+    grown[at:at] = bytes(rng.randrange(256) for _ in range(48))
+
+    tweaked = bytearray(base)
+    for _ in range(40):
+        at = rng.randrange(len(base) - 4)
+        tweaked[at:at + 4] = bytes(rng.randrange(256) for _ in range(4))
+
+    return [("mot/insert", base, bytes(grown)),
+            ("mot/constants", base, bytes(tweaked)),
+            ("mot/same", base, base)]
+
+
+def build_host(tmp):
+    exe = os.path.join(tmp, "delta_host")
+    subprocess.check_call(["gcc", "-O2", "-Wall", "-I", os.path.join(BOOT, "Inc"),
+                           os.path.join(HERE, "delta_host.c"),
+                           os.path.join(BOOT, "Boot_Delta.c"), "-o", exe])
+    return exe
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) % 2:
+        sys.exit(__doc__)
+    if args:
+        pairs = [(os.path.basename(args[i + 1]), open(args[i], "rb").read(),
+                  open(args[i + 1], "rb").read()) for i in range(0, len(args), 2)]
+    else:
+        pairs = build_pairs() + derived_pairs()
+
+    failures = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = build_host(tmp)
+        for name, old, new in pairs:
+            patch = delta_diff.diff(old, new)
+            ok = delta_diff.apply(old, patch) == new
+
+            paths = [os.path.join(tmp, n) for n in ("old.bin", "patch.dlt", "out.bin")]
+            open(paths[0], "wb").write(old)
+            open(paths[1], "wb").write(patch)
+            for feed, step in FEEDS:
+                run = subprocess.run([exe] + paths + [str(feed), str(step)], capture_output=True, text=True)
+                ok = ok and run.returncode == 0 and open(paths[2], "rb").read() == new
+
+            print("%-16s %7u -> %7u bytes, patch %6u bytes (%5.1f%%)  %s"
+                  % (name, len(old), len(new), len(patch), 100.0 * len(patch) / max(len(new), 1),
+                     "ok" if ok else "FAIL"))
+            failures += not ok
+
+    if failures:
+        sys.exit("%u pair(s) failed" % failures)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+fault_decode.py
+
+Symbolize the HardFault post-mortem that L0_APP1, L0_APP2 and
+RF433_Receiver (Common/STM32L0/Fault.c) print on the boot after a fault.
+
+    python3 Tools/fault_decode.py RF433_Receiver.elf capture.txt
+    python3 Tools/fault_decode.py L0_APP1.elf COM7 [--baud 115200]
+    python3 Tools/fault_decode.py L0_APP1.elf -          (stdin)
+
+The record is a group of lines starting with FAULT:
+    FAULT pc <pc> lr <lr> xpsr <xpsr> exc <EXC_RETURN> sp <sp> ms <uptime>
+    FAULT r0 <r0> r1 <r1> r2 <r2> r3 <r3> r12 <r12>
+    FAULT tasks <name>=<ms since check-in> ...
+    FAULT stack <address> <word> <word> <word> <word>
+Other console lines are passed through unchanged. pc, lr and every stack
+word that is a Thumb address inside a function of the ELF are resolved
+to function+offset from the ELF symbol table, and to file:line through
+arm-none-eabi-addr2line when it is on the PATH (or --addr2line). A
+stack word that resolves is a return address or a code pointer left in
+a local: Cortex-M0+ keeps no frame pointers, so the call chain is read
+from them, innermost first.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import argparse
+import bisect
+import shutil
+import struct
+import subprocess
+import sys
+
+from trace_decode import lines_from
+
+STT_FUNC = 2
+
+EXCEPTIONS = {0: "thread mode", 2: "NMI", 3: "HardFault", 11: "SVCall", 14: "PendSV", 15: "SysTick"}
+EXC_RETURN = {0xFFFFFFF1: "handler mode, MSP", 0xFFFFFFF9: "thread mode, MSP",
+              0xFFFFFFFD: "thread mode, PSP"}
+
+
+def elf_functions(path):
+    """Sorted [(start, end, name)] of the function symbols, ELF32 or ELF64."""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("%s: not an ELF file" % path)
+    is64 = elf[4] == 2
+    end = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", elf, 0x28)
+        shentsize, shnum = struct.unpack_from(end + "HH", elf, 0x3A)
+        shdr = struct.Struct(end + "IIQQQQIIQQ")
+        sym = struct.Struct(end + "IBBHQQ")
+    else:
+        shoff, = struct.unpack_from(end + "I", elf, 0x20)
+        shentsize, shnum = struct.unpack_from(end + "HH", elf, 0x2E)
+        shdr = struct.Struct(end + "IIIIIIIIII")
+        sym = struct.Struct(end + "IIIBBH")
+
+    sections = [shdr.unpack_from(elf, shoff + i * shentsize) for i in range(shnum)]
+    funcs = []
+    for sec in sections:
+        if sec[1] != 2:                     # SHT_SYMTAB
+            continue
+        strtab = sections[sec[6]]
+        for off in range(sec[4], sec[4] + sec[5], sym.size):
+            if is64:
+                name, info, _, _, value, size = sym.unpack_from(elf, off)
+            else:
+                name, value, size, info, _, _ = sym.unpack_from(elf, off)
+            if info & 0xF != STT_FUNC or not size:
+                continue
+            s = strtab[4] + name
+            value &= ~1                     # Thumb bit
+            funcs.append((value, value + size, elf[s:elf.index(b"\0", s)].decode()))
+    if not funcs:
+        raise ValueError("%s: no function symbols (stripped?)" % path)
+    funcs.sort()
+    return funcs
+
+
+class Symbolizer:
+    def __init__(self, elf, addr2line):
+        self.elf = elf
+        self.funcs = elf_functions(elf)
+        self.starts = [f[0] for f in self.funcs]
+        self.addr2line = addr2line
+
+    def function(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i >= 0 and addr < self.funcs[i][1]:
+            return self.funcs[i]
+        return None
+
+    def lines(self, addrs):
+        """{addr: 'file:line'} from addr2line, empty without it."""
+        if not self.addr2line or not addrs:
+            return {}
+        out = subprocess.run([self.addr2line, "-e", self.elf] + ["%x" % a for a in addrs],
+                             capture_output=True, text=True).stdout.splitlines()
+        return {a: l for a, l in zip(addrs, out) if not l.startswith("??")}
+
+    def name(self, addr, where):
+        f = self.function(addr)
+        if f is None:
+            return "?"
+        text = "%s+0x%x" % (f[2], addr - f[0])
+        return text + (" (%s)" % where[addr] if addr in where else "")
+
+
+class Record:
+    def __init__(self):
+        self.regs = {}
+        self.tasks = []
+        self.stack = []                     # [(address, word)]
+
+    def add(self, words):
+        kind = words[1]
+        if kind == "tasks":
+            self.tasks = words[2:]
+        elif kind == "stack":
+            addr = int(words[2], 16)
+            self.stack += [(addr + 4 * i, int(w, 16)) for i, w in enumerate(words[3:])]
+        else:
+            it = iter(words[1:])
+            for key, value in zip(it, it):
+                self.regs[key] = int(value, 10 if key == "ms" else 16)
+
+    def report(self, sym):
+        r = self.regs
+        pc, lr, xpsr = r.get("pc", 0), r.get("lr", 0), r.get("xpsr", 0)
+        # Thumb return addresses point past the call: look up the call itself
+        calls = [(a, w) for a, w in self.stack if w & 1 and sym.function(w & ~1)]
+        where = sym.lines([pc] + [(lr & ~1) - 2] + [(w & ~1) - 2 for _, w in calls])
+
+        out = ["HardFault at %.3f s, in %s, %s" % (
+            r.get("ms", 0) / 1000.0, EXCEPTIONS.get(xpsr & 0x3F, "IRQ %d" % ((xpsr & 0x3F) - 16)),
+            EXC_RETURN.get(r.get("exc", 0), "EXC_RETURN 0x%08x" % r.get("exc", 0)))]
+        out.append("  pc  %08x  %s" % (pc, sym.name(pc, where)))
+        out.append("  lr  %08x  %s" % (lr, sym.name((lr & ~1) - 2, where)))
+        if not xpsr & (1 << 24):
+            out.append("  xPSR T bit clear: a branch to an address without bit 0 set")
+        elif sym.function(pc) is None:
+            out.append("  pc is outside every function: a bad function pointer or a corrupted return")
+        out.append("  r0 %08x  r1 %08x  r2 %08x  r3 %08x  r12 %08x  sp %08x" % (
+            r.get("r0", 0), r.get("r1", 0), r.get("r2", 0), r.get("r3", 0), r.get("r12", 0), r.get("sp", 0)))
+        if self.tasks:
+            out.append("  ms since check-in: " + ", ".join(self.tasks))
+        if calls:
+            out.append("  call chain from the stack, innermost first:")
+            for addr, w in calls:
+                out.append("    [sp+0x%02x] %08x  %s" % (addr - r.get("sp", addr), w,
+                                                         sym.name((w & ~1) - 2, where)))
+        return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Symbolize FAULT post-mortem lines")
+    ap.add_argument("elf", help="firmware ELF that was running when it faulted")
+    ap.add_argument("source", help="capture file, serial port or - for stdin")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--addr2line", default=shutil.which("arm-none-eabi-addr2line"),
+                    help="addr2line for file:line (default: arm-none-eabi-addr2line on PATH)")
+    opt = ap.parse_args()
+
+    sym = Symbolizer(opt.elf, opt.addr2line)
+    rec = None
+    try:
+        for line in lines_from(opt.source, opt.baud):
+            words = line.split()
+            if words[:1] == ["FAULT"] and len(words) > 1:
+                # A new record starts with its pc line
+                if words[1] == "pc" and rec is not None:
+                    print(rec.report(sym), flush=True)
+                    rec = None
+                rec = rec or Record()
+                try:
+                    rec.add(words)
+                except ValueError:
+                    print(line)
+                continue
+            if rec is not None:
+                print(rec.report(sym), flush=True)
+                rec = None
+            if line:
+                print(line, flush=True)
+        if rec is not None:
+            print(rec.report(sym))
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""
+map_report.py
+
+Per-module flash and RAM use from a GNU ld map file (the .map that
+STM32CubeIDE writes next to the .elf with -Wl,-Map).
+
+    python3 Tools/map_report.py RF433_Receiver/Debug/RF433_Receiver.map
+    python3 Tools/map_report.py L0_APP1/Debug/L0_APP1.map --top 15 --members
+    python3 Tools/map_report.py app.map --csv > app.csv
+
+A module is an object file; archive members are summed per library
+unless --members is given. Flash counts every input section whose load
+address is in a non-writable region (so .data and .ramfunc count
+twice, once as their flash image). RAM counts every input section whose
+run address is in a writable region. The sections that only reserve
+space (._user_heap_stack, .pool, NOINIT) are listed separately, with
+the space left in each memory region, so the stack can be sized against
+Ram_UsageGet() measurements (Common/STM32L0/Ram_Usage.c).
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import defaultdict
+
+REGION = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S+))?\s*$")
+OUTPUT = re.compile(r"^(\.?\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?)?\s*$")
+INPUT = re.compile(r"^ (\*fill\*|\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*))?)?\s*$")
+ADDR_ONLY = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*))?\s*$")
+
+# Host maps only have the *default* region: classify by output section name
+RAM_NAMES = (".data", ".bss", ".noinit", ".ramfunc", ".pool", "._user_heap_stack", ".tbss", ".tdata")
+NOLOAD_NAMES = (".bss", ".noinit", ".pool", "._user_heap_stack", ".tbss")
+# Output sections that only move the location counter
+RESERVED_NAMES = ("._user_heap_stack", ".pool", ".noinit")
+
+
+class Region:
+    def __init__(self, name, origin, length, attrs):
+        self.name, self.origin, self.length = name, origin, length
+        self.writable = "w" in attrs and "!w" not in attrs
+        self.used = 0
+
+    def holds(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+
+def module_name(path, members):
+    path = path.strip()
+    m = re.match(r"(.*\.a)\((.*)\)$", path)
+    if m:
+        return "%s(%s)" % (os.path.basename(m.group(1)), m.group(2)) if members else os.path.basename(m.group(1))
+    return os.path.normpath(path)
+
+
+def parse(lines, members):
+    regions = []
+    modules = defaultdict(lambda: {"flash": 0, "ram": 0, "sections": defaultdict(int)})
+    reserved = []
+    state = "head"
+    out = None          # current output section: [name, vma, size, lma]
+    pending = None      # input section name waiting for its address line
+
+    def region_of(addr):
+        for r in regions:
+            if r.holds(addr):
+                return r
+        return None
+
+    def place(sec):
+        """Charge an output section to its run and load regions."""
+        if not sec[1]:
+            return
+        run = region_of(sec[1])
+        if run is not None:
+            run.used += sec[2]
+        load = region_of(sec[3]) if sec[3] is not None else None
+        if load is not None and load is not run:
+            load.used += sec[2]
+        if sec[0] in RESERVED_NAMES:
+            reserved.append((sec[0], sec[1], sec[2]))
+
+    def in_ram(addr):
+        r = region_of(addr)
+        return r.writable if r is not None else out[0].startswith(RAM_NAMES)
+
+    def in_flash(addr):
+        r = region_of(addr)
+        return not r.writable if r is not None else not out[0].startswith(NOLOAD_NAMES)
+
+    def account(addr, size, path):
+        if size == 0 or out[1] == 0:
+            return                                       # debug and INFO sections
+        mod = modules[module_name(path, members)]
+        if in_ram(addr):
+            mod["ram"] += size
+        if in_flash(out[3] + (addr - out[1]) if out[3] is not None else addr):
+            mod["flash"] += size
+        mod["sections"][out[0]] += size
+
+    for raw in lines:
+        line = raw.rstrip("\n")
+        if state == "head":
+            if line.startswith("Memory Configuration"):
+                state = "memory"
+            continue
+        if state == "memory":
+            if line.startswith("Linker script and memory map"):
+                state = "map"
+                continue
+            m = REGION.match(line)
+            if m and m.group(1) not in ("Name", "*default*"):
+                regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4) or ""))
+            continue
+
+        if pending is not None:
+            m = ADDR_ONLY.match(line)
+            if m:
+                if m.group(3):
+                    account(int(m.group(1), 16), int(m.group(2), 16), m.group(3))
+                pending = None
+                continue
+            pending = None
+
+        if line and not line[0].isspace():
+            m = OUTPUT.match(line)
+            if not m or not m.group(1).startswith((".", "COMMON")):
+                continue
+            if m.group(2) is None:
+                out = [m.group(1), None, None, None]       # address on the next line
+                continue
+            out = [m.group(1), int(m.group(2), 16), int(m.group(3), 16),
+                   int(m.group(4), 16) if m.group(4) else None]
+            place(out)
+            continue
+
+        if out is not None and out[1] is None:
+            m = ADDR_ONLY.match(line)
+            if m:
+                rest = m.group(3) or ""
+                lm = re.match(r"load address 0x([0-9a-fA-F]+)", rest)
+                out[1], out[2] = int(m.group(1), 16), int(m.group(2), 16)
+                out[3] = int(lm.group(1), 16) if lm else None
+                place(out)
+                continue
+
+        m = INPUT.match(line)
+        if not m or out is None or out[1] is None:
+            continue
+        name = m.group(1)
+        if name.startswith("*") and name != "*fill*":
+            continue                                   # *(.text) patterns
+        if m.group(2) is None:
+            pending = name
+            continue
+        addr, size = int(m.group(2), 16), int(m.group(3), 16)
+        if name == "*fill*":
+            account(addr, size, "(fill)")
+        elif m.group(4):
+            account(addr, size, m.group(4))
+
+    return regions, modules, reserved
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Per-module RAM/flash report from a GNU ld map file")
+    ap.add_argument("map", help="linker map file")
+    ap.add_argument("--top", type=int, default=0, help="only the N largest modules")
+    ap.add_argument("--sort", choices=("ram", "flash"), default="ram")
+    ap.add_argument("--members", action="store_true", help="split libraries into members")
+    ap.add_argument("--csv", action="store_true")
+    opt = ap.parse_args()
+
+    with open(opt.map, errors="replace") as f:
+        lines = f.readlines()
+    regions, modules, res = parse(lines, opt.members)
+
+    rows = sorted(modules.items(), key=lambda kv: (kv[1][opt.sort], kv[1]["flash"] + kv[1]["ram"]), reverse=True)
+    rows = [r for r in rows if r[1]["flash"] or r[1]["ram"]]
+    if opt.top:
+        rows = rows[:opt.top]
+
+    if opt.csv:
+        print("module,flash,ram")
+        for name, m in rows:
+            print("%s,%u,%u" % (name, m["flash"], m["ram"]))
+        return 0
+
+    width = max([len(n) for n, _ in rows] + [6])
+    print("%-*s %8s %8s  sections" % (width, "module", "flash", "ram"))
+    for name, m in rows:
+        secs = ", ".join("%s %u" % (s, n) for s, n in sorted(m["sections"].items(), key=lambda kv: -kv[1]))
+        print("%-*s %8u %8u  %s" % (width, name, m["flash"], m["ram"], secs))
+    print("%-*s %8u %8u" % (width, "total", sum(m["flash"] for m in modules.values()),
+                            sum(m["ram"] for m in modules.values())))
+
+    if res:
+        print()
+        for name, addr, size in res:
+            print("reserved %-18s 0x%08x %6u bytes" % (name, addr, size))
+    if regions:
+        print()
+        for r in regions:
+            pct = 100.0 * r.used / r.length if r.length else 0.0
+            print("region %-8s %7u / %7u bytes (%5.1f%%), %u free" % (r.name, r.used, r.length, pct,
+                                                                      r.length - r.used))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,278 @@
+/*
+ * rf_bulk_sim.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Runs the RF bulk transfer (RF433_Receiver/RF_Receiver/RF_Bulk.c) over a
+ *  simulated lossy RH_ASK link and reports goodput:
+ *
+ *  gcc -O2 -Wall -I../RF433_Receiver/RF_Receiver/Inc rf_bulk_sim.c \
+ *      ../RF433_Receiver/RF_Receiver/RF_Bulk.c -o rf_bulk_sim
+ *  ./rf_bulk_sim [image size] [runs]
+ *
+ *  Every frame is dropped with the given probability, in both directions.
+ *  Airtime follows RH_ASK at 2000 bit/s: 8 preamble/start symbols, then
+ *  count, 4 headers, payload and FCS at two 6-bit symbols per byte. The
+ *  clock only moves while a frame is on air or a node is waiting.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RF_Bulk.h"
+
+/* Define --------------------------------------------------------------------*/
+#define SIM_MAX_IMAGE 					(96U * 1024U)
+#define SIM_QUEUE 						8
+#define SIM_GAP_US 						2000U		/* TX/RX turnaround			*/
+#define SIM_BIT_US 						500U		/* 2000 bit/s				*/
+#define SIM_LIMIT_US 					(4ULL * 3600ULL * 1000000ULL)
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	uint8_t flags, id, len;
+	uint8_t data[RH_ASK_MAX_MESSAGE_LEN];
+}Sim_Frame_S;
+
+typedef struct {
+	Sim_Frame_S q[SIM_QUEUE];
+	uint8_t head, count;
+}Sim_Queue_S;
+
+/* Variables -----------------------------------------------------------------*/
+static uint64_t clockUs;
+static uint32_t rng = 1;
+static double   lossRate;
+static Sim_Queue_S toRx, toTx;
+
+static uint8_t  image[SIM_MAX_IMAGE];
+static uint8_t  out[SIM_MAX_IMAGE];
+static uint32_t imageLen;
+
+/* Sink state that survives a receiver restart, as EEPROM would */
+static uint32_t sinkToken;
+static uint32_t sinkChunks;
+
+/* Function prototypes -------------------------------------------------------*/
+
+static uint32_t Sim_Rand(void)
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static uint32_t Sim_Crc32(const uint8_t *p, uint32_t len)
+{
+	uint32_t crc = 0xFFFFFFFFU;
+	int k;
+
+	while (len--) {
+		crc ^= *p++;
+		for (k = 0; k < 8; k++) {
+			crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+		}
+	}
+	return ~crc;
+}
+
+static uint32_t Sim_Airtime(uint8_t len)
+{
+	return (48U + ((uint32_t)len + 7U) * 12U) * SIM_BIT_US + SIM_GAP_US;
+}
+
+static Bool_E Sim_Send(Sim_Queue_S *dst, uint8_t flags, uint8_t id, const uint8_t *data, uint8_t len)
+{
+	Sim_Frame_S *f;
+
+	clockUs += Sim_Airtime(len);
+	if (((double)Sim_Rand() / 4294967296.0) < lossRate) {
+		return True;					/* lost on air				*/
+	}
+	if (dst->count == SIM_QUEUE) {
+		return True;
+	}
+	f = &dst->q[(dst->head + dst->count++) % SIM_QUEUE];
+	f->flags = flags;
+	f->id    = id;
+	f->len   = len;
+	memcpy(f->data, data, len);
+	return True;
+}
+
+static Bool_E Sim_Recv(Sim_Queue_S *src, uint8_t *flags, uint8_t *id, uint8_t *data, uint8_t *len)
+{
+	Sim_Frame_S *f;
+
+	if (src->count == 0) {
+		return False;
+	}
+	f = &src->q[src->head];
+	src->head = (src->head + 1) % SIM_QUEUE;
+	src->count--;
+	*flags = f->flags;
+	*id    = f->id;
+	if (*len > f->len) {
+		*len = f->len;
+	}
+	memcpy(data, f->data, *len);
+	return True;
+}
+
+static Bool_E Tx_Send(uint8_t flags, uint8_t id, const uint8_t *data, uint8_t len)
+{
+	return Sim_Send(&toRx, flags, id, data, len);
+}
+
+static Bool_E Tx_Recv(uint8_t *flags, uint8_t *id, uint8_t *data, uint8_t *len)
+{
+	return Sim_Recv(&toTx, flags, id, data, len);
+}
+
+static Bool_E Rx_Send(uint8_t flags, uint8_t id, const uint8_t *data, uint8_t len)
+{
+	return Sim_Send(&toTx, flags, id, data, len);
+}
+
+static Bool_E Rx_Recv(uint8_t *flags, uint8_t *id, uint8_t *data, uint8_t *len)
+{
+	return Sim_Recv(&toRx, flags, id, data, len);
+}
+
+static uint32_t Sim_Tick(void)
+{
+	return (uint32_t)(clockUs / 1000U);
+}
+
+static uint32_t Sink_Begin(uint32_t token, uint32_t length)
+{
+	if ((length > SIM_MAX_IMAGE) || (token != sinkToken)) {
+		sinkToken  = token;
+		sinkChunks = 0;
+	}
+	return (length > SIM_MAX_IMAGE) ? RF_BULK_REFUSE : sinkChunks;
+}
+
+static int Sink_Write(uint32_t offset, const uint8_t *data, uint8_t len)
+{
+	memcpy(&out[offset], data, len);
+	sinkChunks = (offset / RF_BULK_CHUNK_SIZE) + 1U;
+	return 0;
+}
+
+static int Sink_End(void)
+{
+	return (Sim_Crc32(out, imageLen) == sinkToken) ? 0 : -1;
+}
+
+static const Handle_RF_BulkLink_S txLink = { Tx_Send, Tx_Recv, Sim_Tick };
+static const Handle_RF_BulkLink_S rxLink = { Rx_Send, Rx_Recv, Sim_Tick };
+static const Handle_RF_BulkSink_S sink   = { Sink_Begin, Sink_Write, Sink_End };
+
+/*
+ * @brief : Run both ends until the sender finishes, or until <stopAt> chunks are sent
+ * @retval : Handle_RF_BulkStatus_E - sender state
+ */
+static Handle_RF_BulkStatus_E Sim_Run(Handle_RF_BulkTx_S *tx, Handle_RF_BulkRx_S *rx, uint32_t stopAt)
+{
+	Handle_RF_BulkStatus_E st;
+	uint64_t before;
+
+	do {
+		before = clockUs;
+		st = RF_BulkTxPoll(tx);
+		RF_BulkRxPoll(rx);
+		if (clockUs == before) {
+			clockUs += 1000U;
+		}
+		if (clockUs > SIM_LIMIT_US) {
+			return RFBulkFailed;
+		}
+	} while ((st == RFBulkBusy) && (tx->sent < stopAt));
+	return st;
+}
+
+int main(int argc, char **argv)
+{
+	static const double rates[] = { 0.0, 0.01, 0.05, 0.20 };
+	static Handle_RF_BulkTx_S tx;
+	static Handle_RF_BulkRx_S rx;
+	uint32_t runs = 5, i, r, token, resumeAt;
+	double ideal;
+	int fail = 0;
+
+	imageLen = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : (32U * 1024U);
+	if (argc > 2) {
+		runs = (uint32_t)strtoul(argv[2], NULL, 0);
+	}
+	if ((imageLen == 0) || (imageLen > SIM_MAX_IMAGE) || (runs == 0)) {
+		fprintf(stderr, "usage: rf_bulk_sim [image size <= %u] [runs]\n", SIM_MAX_IMAGE);
+		return 2;
+	}
+	for (i = 0; i < imageLen; i++) {
+		image[i] = (uint8_t)Sim_Rand();
+	}
+	token = Sim_Crc32(image, imageLen);
+	ideal = (double)RF_BULK_CHUNK_SIZE * 1e6 / (double)Sim_Airtime(RF_BULK_CHUNK_SIZE);
+
+	printf("image %u bytes, window %u, chunk %u, raw channel %.1f B/s\n",
+			imageLen, RF_BULK_WINDOW, RF_BULK_CHUNK_SIZE, ideal);
+	printf("  loss   goodput    eff   frames  resends      time\n");
+
+	for (r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		double seconds = 0, frames = 0, resends = 0;
+
+		lossRate = rates[r];
+		for (i = 0; i < runs; i++) {
+			rng = 0x9E3779B9U + i * 7919U + r;
+			clockUs = 0;
+			memset(&toRx, 0, sizeof(toRx));
+			memset(&toTx, 0, sizeof(toTx));
+			memset(out, 0, sizeof(out));
+			sinkToken = 0;
+			RF_BulkRxInit(&rx, &rxLink, &sink);
+			RF_BulkTxInit(&tx, &txLink, token, image, imageLen);
+			if ((Sim_Run(&tx, &rx, 0xFFFFFFFFU) != RFBulkDone) || memcmp(out, image, imageLen)) {
+				printf("  %3.0f%%   run %u FAILED\n", lossRate * 100, i);
+				fail = 1;
+				continue;
+			}
+			seconds += (double)clockUs / 1e6;
+			frames  += tx.frames;
+			resends += tx.resends;
+		}
+		printf("  %3.0f%%  %6.1f B/s  %4.1f%%  %7.0f  %7.0f  %7.1f s\n",
+				lossRate * 100, imageLen * runs / seconds,
+				100.0 * imageLen * runs / seconds / ideal,
+				frames / runs, resends / runs, seconds / runs);
+	}
+
+	/* Resume: both ends restart half way, the sink keeps its progress */
+	lossRate = 0.05;
+	clockUs = 0;
+	memset(&toRx, 0, sizeof(toRx));
+	memset(&toTx, 0, sizeof(toTx));
+	memset(out, 0, sizeof(out));
+	sinkToken = 0;
+	RF_BulkRxInit(&rx, &rxLink, &sink);
+	RF_BulkTxInit(&tx, &txLink, token, image, imageLen);
+	Sim_Run(&tx, &rx, tx.chunks / 2U);
+	memset(&toRx, 0, sizeof(toRx));
+	memset(&toTx, 0, sizeof(toTx));
+	RF_BulkRxInit(&rx, &rxLink, &sink);
+	RF_BulkTxInit(&tx, &txLink, token, image, imageLen);
+	resumeAt = sinkChunks;
+	if ((Sim_Run(&tx, &rx, 0xFFFFFFFFU) != RFBulkDone) || memcmp(out, image, imageLen)
+			|| (resumeAt == 0) || (tx.frames >= tx.chunks)) {
+		printf("resume: FAILED\n");
+		fail = 1;
+	} else {
+		printf("resume: restarted at chunk %u of %u, %u frames after restart\n",
+				resumeAt, tx.chunks, tx.frames);
+	}
+
+	return fail;
+}
@@ -0,0 +1,331 @@
+/*
+ * rf_log_sim.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Runs the flash ring logger (RF433_Receiver/RF_Receiver/RF_Log.c) on
+ *  a simulated STM32L0 flash and reports sustained throughput and the
+ *  recovery after resets that cut a flash operation:
+ *
+ *  gcc -O2 -Wall -I../RF433_Receiver/RF_Receiver/Inc rf_log_sim.c \
+ *      ../RF433_Receiver/RF_Receiver/RF_Log.c -o rf_log_sim
+ *  ./rf_log_sim [resets] [seed]
+ *
+ *  Erased flash reads 0. A page erase and a half-page program each take
+ *  SIM_OP_US; programming a word that is not erased fails as NOTZEROERR
+ *  does. A reset in the middle of an operation leaves the page or the
+ *  half-page with random words. After every reset the ring is checked:
+ *  each committed block must read back as written, without gaps, from
+ *  the oldest surviving one to the last one whose program finished.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "RF_Log.h"
+
+/* Define --------------------------------------------------------------------*/
+#define SIM_FLASH_SIZE 					(16U * 1024U)
+#define SIM_OP_US 						3200U		/* L0 erase / half-page program	*/
+#define SIM_LOOP_US 					40U			/* main loop pass, 16 MHz		*/
+#define SIM_MAX_SEQ 					200000U
+#define SIM_BENCH_SAMPLES 				60000U
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	int 		op;							/* 0 none, 1 erase, 2 program		*/
+	uint32_t 	offset;
+	uint32_t 	words[RF_LOG_BLOCK_SIZE / 4U];
+	uint64_t 	doneUs;
+	int 		failed;
+
+}Sim_Op_S;
+
+/* Variables -----------------------------------------------------------------*/
+static uint32_t flashWords[SIM_FLASH_SIZE / 4U];
+static Sim_Op_S pending;
+static uint64_t clockUs;
+static uint32_t rng = 1;
+static uint32_t notZeroErrors;
+
+/* Every block as it was handed to program(), by sequence number */
+static Handle_RF_LogBlock_S shadow[SIM_MAX_SEQ];
+static uint32_t lastDone;					/* newest seq fully programmed		*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+static uint32_t Sim_Rand(void)
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/*
+ * @brief : Finish the operation in flight once its time has passed
+ */
+static void Sim_Advance(void)
+{
+	uint32_t i, *w;
+
+	if ((pending.op == 0) || (clockUs < pending.doneUs)) {
+		return;
+	}
+
+	w = &flashWords[pending.offset / 4U];
+	if (pending.op == 1) {
+		memset(w, 0, RF_LOG_PAGE_SIZE);
+	}
+	else {
+		for (i = 0; i < (RF_LOG_BLOCK_SIZE / 4U); i++) {
+			if (w[i] != 0) {
+				pending.failed = 1;
+				notZeroErrors++;
+				break;
+			}
+		}
+		if (!pending.failed) {
+			memcpy(w, pending.words, RF_LOG_BLOCK_SIZE);
+			lastDone = ((const Handle_RF_LogBlock_S *)w)->seq;
+		}
+	}
+	pending.op = 0;
+}
+
+static int Sim_Status(void)
+{
+	int failed;
+
+	Sim_Advance();
+	if (pending.op != 0) {
+		return 1;
+	}
+	failed = pending.failed;
+	pending.failed = 0;
+	return failed ? -1 : 0;
+}
+
+static void Sim_Erase(uint32_t offset)
+{
+	pending.op 		= 1;
+	pending.offset 	= offset;
+	pending.doneUs 	= clockUs + SIM_OP_US;
+}
+
+static void Sim_Program(uint32_t offset, const uint32_t *words)
+{
+	const Handle_RF_LogBlock_S *blk = (const Handle_RF_LogBlock_S *)words;
+
+	pending.op 		= 2;
+	pending.offset 	= offset;
+	pending.doneUs 	= clockUs + SIM_OP_US;
+	memcpy(pending.words, words, RF_LOG_BLOCK_SIZE);
+	if (blk->seq < SIM_MAX_SEQ) {
+		shadow[blk->seq] = *blk;
+	}
+}
+
+static const Handle_RF_LogFlash_S simFlash = {
+	(const uint8_t *)flashWords,
+	SIM_FLASH_SIZE,
+	Sim_Status,
+	Sim_Erase,
+	Sim_Program
+};
+
+/*
+ * @brief : Power cut: an operation in flight leaves random words behind
+ */
+static void Sim_Reset(void)
+{
+	uint32_t i, n, *w;
+
+	if (pending.op != 0) {
+		n = (pending.op == 1) ? RF_LOG_PAGE_SIZE / 4U : RF_LOG_BLOCK_SIZE / 4U;
+		w = &flashWords[pending.offset / 4U];
+		for (i = 0; i < n; i++) {
+			switch (Sim_Rand() % 3U) {
+			case 0:  w[i] = 0; break;
+			case 1:  w[i] = Sim_Rand(); break;
+			default: w[i] = (pending.op == 2) ? pending.words[i] : w[i]; break;
+			}
+		}
+	}
+	memset(&pending, 0, sizeof(pending));
+}
+
+/*
+ * @brief : Sample source, a slow random walk, so most samples fit a delta
+ */
+static void Sim_Sample(int16_t *v)
+{
+	uint32_t c;
+
+	for (c = 0; c < RF_LOG_CHANNELS; c++) {
+		v[c] = (int16_t)(v[c] + (int16_t)(Sim_Rand() % 41U) - 20);
+	}
+	if ((Sim_Rand() % 64U) == 0) {
+		v[0] = (int16_t)(v[0] + 1000);		/* a step that needs a new block */
+	}
+}
+
+/*
+ * @brief : Compare the ring with what was programmed
+ * @retval : 0 when consistent
+ */
+static int Sim_Check(const Handle_RF_Log_S *log, uint32_t *oldest, uint32_t *newest)
+{
+	static uint8_t seen[SIM_MAX_SEQ];
+	const Handle_RF_LogBlock_S *blk;
+	uint32_t offset, lo = 0xFFFFFFFFU, hi = 0, s;
+
+	memset(seen, 0, sizeof(seen));
+	for (offset = 0; offset < SIM_FLASH_SIZE; offset += RF_LOG_BLOCK_SIZE) {
+		blk = RF_LogBlock(log, offset);
+		if (blk == NULL) {
+			continue;
+		}
+		if ((blk->seq >= SIM_MAX_SEQ) || memcmp(blk, &shadow[blk->seq], sizeof(*blk))) {
+			printf("block at 0x%04x seq %u does not match what was written\n", offset, blk->seq);
+			return -1;
+		}
+		seen[blk->seq] = 1;
+		lo = (blk->seq < lo) ? blk->seq : lo;
+		hi = (blk->seq > hi) ? blk->seq : hi;
+	}
+	if (hi == 0) {
+		*oldest = *newest = 0;
+		return 0;
+	}
+	for (s = lo; s <= hi; s++) {
+		if (!seen[s]) {
+			printf("gap: seq %u missing between %u and %u\n", s, lo, hi);
+			return -1;
+		}
+	}
+	if (hi != lastDone) {
+		printf("newest block %u, last completed program %u\n", hi, lastDone);
+		return -1;
+	}
+	*oldest = lo;
+	*newest = hi;
+	return 0;
+}
+
+/*
+ * @brief : Log flat out for SIM_BENCH_SAMPLES samples
+ */
+static void Sim_Throughput(void)
+{
+	Handle_RF_Log_S log;
+	int16_t v[RF_LOG_CHANNELS] = {0};
+	uint64_t start;
+	uint32_t i = 0;
+	double secs;
+
+	memset(flashWords, 0, sizeof(flashWords));
+	memset(&pending, 0, sizeof(pending));
+	clockUs = 0;
+	RF_LogInit(&log, &simFlash);
+
+	start = clockUs;
+	while (i < SIM_BENCH_SAMPLES) {
+		if (log.qCount < RF_LOG_QUEUE) {
+			Sim_Sample(v);
+			RF_LogAppend(&log, (uint32_t)(clockUs / 1000U), v);
+			i++;
+		}
+		RF_LogService(&log);
+		clockUs += SIM_LOOP_US;
+	}
+	while (log.qCount == RF_LOG_QUEUE) {
+		RF_LogService(&log);
+		clockUs += SIM_LOOP_US;
+	}
+	RF_LogFlush(&log);
+	while (RF_LogService(&log)) {
+		clockUs += SIM_LOOP_US;
+	}
+	secs = (double)(clockUs - start) / 1e6;
+
+	printf("throughput: %u samples, %u blocks, %u erases in %.2f s (simulated)\n",
+			i, log.blocks, log.erases, secs);
+	printf("            %.0f samples/s, %.0f B/s of flash, %.2f B/sample "
+			"(raw %u B: 4 time + 2 per channel)\n",
+			i / secs, log.blocks * (double)RF_LOG_BLOCK_SIZE / secs,
+			log.blocks * (double)RF_LOG_BLOCK_SIZE / i, 4U + 2U * RF_LOG_CHANNELS);
+	printf("            %u dropped, %u flash errors, %u program-on-dirty\n",
+			log.dropped, log.errors, notZeroErrors);
+}
+
+int main(int argc, char **argv)
+{
+	Handle_RF_Log_S log;
+	int16_t v[RF_LOG_CHANNELS] = {0};
+	uint32_t resets = (argc > 1) ? (uint32_t)atoi(argv[1]) : 2000U;
+	uint32_t r, run, oldest = 0, newest = 0, maxWords = 0, skipped = 0, lostQueued = 0;
+	uint64_t scanWords = 0;
+	clock_t t0;
+	double hostNs = 0;
+
+	rng = (argc > 2) ? (uint32_t)atoi(argv[2]) : 1U;
+	if (rng == 0) {
+		rng = 1;
+	}
+
+	Sim_Throughput();
+
+	/* Power cuts at random points, 20 to 2000 samples apart */
+	memset(flashWords, 0, sizeof(flashWords));
+	memset(&pending, 0, sizeof(pending));
+	clockUs = 0;
+	lastDone = 0;
+	notZeroErrors = 0;
+	RF_LogInit(&log, &simFlash);
+
+	for (r = 0; r < resets; r++) {
+		run = 20U + (Sim_Rand() % 2000U);
+		while (run--) {
+			Sim_Sample(v);
+			RF_LogAppend(&log, (uint32_t)(clockUs / 1000U), v);
+			RF_LogService(&log);
+			clockUs += 1000U + (Sim_Rand() % 4000U);
+			RF_LogService(&log);
+		}
+		lostQueued += log.qCount;
+		Sim_Reset();
+
+		t0 = clock();
+		RF_LogInit(&log, &simFlash);
+		hostNs += (double)(clock() - t0) * 1e9 / CLOCKS_PER_SEC;
+
+		scanWords += log.scanWords;
+		maxWords = (log.scanWords > maxWords) ? log.scanWords : maxWords;
+		skipped += log.skipped;
+
+		if (Sim_Check(&log, &oldest, &newest) != 0) {
+			printf("reset %u: ring inconsistent\n", r);
+			return 1;
+		}
+		if (log.seq != newest + 1U) {
+			printf("reset %u: next seq %u after newest %u\n", r, log.seq, newest);
+			return 1;
+		}
+		if (newest >= SIM_MAX_SEQ - 64U) {
+			resets = r + 1U;
+			break;
+		}
+	}
+
+	printf("recovery:   %u resets, ring checked after each, %u blocks written, "
+			"%u in the ring at the end\n", resets, newest, newest - oldest + 1U);
+	printf("            %.0f words read per recovery (max %u), %u torn blocks stepped over\n",
+			(double)scanWords / resets, maxWords, skipped);
+	printf("            %.1f us per recovery on the host, %u queued blocks lost to resets, "
+			"%u program-on-dirty\n", hostNs / 1000.0 / resets, lostQueued, notZeroErrors);
+	return notZeroErrors ? 1 : 0;
+}
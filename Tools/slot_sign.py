@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""
+slot_sign.py
+
+Patch the CRC-32 of an L0_APP1 / L0_APP2 image into its slot header.
+
+    arm-none-eabi-objcopy -O binary L0_APP2.elf L0_APP2.bin
+    python3 Tools/slot_sign.py L0_APP2.bin [-o L0_APP2_signed.bin]
+
+Header (Boot/Inc/Boot_Slot.h) sits at image offset 0xC0:
+    magic, version, length, crc32   (little-endian words)
+The CRC is zlib CRC-32 over [0, length) with the crc32 word skipped,
+which is what Boot_SlotVerify() computes on the CRC unit.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+HEADER_OFFSET = 0xC0
+HEADER_FORMAT = "<IIII"
+SLOT_MAGIC = 0x544F4C53
+CRC_OFFSET = HEADER_OFFSET + 12
+
+
+def slot_crc(image, length):
+    crc = zlib.crc32(image[:CRC_OFFSET])
+    crc = zlib.crc32(image[CRC_OFFSET + 4:length], crc)
+    return crc & 0xFFFFFFFF
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Sign an STM32L0 slot image")
+    parser.add_argument("image", help="raw binary from objcopy -O binary")
+    parser.add_argument("-o", "--output", help="output file (default: in place)")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        image = bytearray(f.read())
+
+    if len(image) < HEADER_OFFSET + struct.calcsize(HEADER_FORMAT):
+        sys.exit("image too small for a slot header")
+
+    magic, version, length, _ = struct.unpack_from(HEADER_FORMAT, image, HEADER_OFFSET)
+    if magic != SLOT_MAGIC:
+        sys.exit("no slot header at 0x%X (magic 0x%08X)" % (HEADER_OFFSET, magic))
+    if length > len(image) or length % 4:
+        sys.exit("header length %u does not match a %u byte image" % (length, len(image)))
+
+    crc = slot_crc(image, length)
+    struct.pack_into("<I", image, CRC_OFFSET, crc)
+
+    with open(args.output or args.image, "wb") as f:
+        f.write(image[:length])
+
+    print("version 0x%08X, length %u, crc32 0x%08X" % (version, length, crc))
+
+
+if __name__ == "__main__":
+    main()
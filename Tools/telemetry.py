@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""
+telemetry.py
+
+Host side of the COBS-framed telemetry records (Common/Telemetry/src/
+Telemetry.c, built into RF433_Receiver and HLW8012/HLW8012_esp8285).
+
+As a library:
+
+    import telemetry
+    reader = telemetry.Reader()
+    for rec in reader.feed(chunk):        # bytes from the UART
+        print(rec.name, rec.seq, rec.time_ms, rec.fields)
+
+From the command line, one record per line:
+
+    python3 Tools/telemetry.py COM7 [--baud 115200]
+    python3 Tools/telemetry.py capture.bin
+
+Record before COBS: [type][seq:16][time ms:32][fields...][crc16], little
+endian, CRC-16/CCITT (0x1021, init 0xFFFF). A field is a byte with the
+kind in bits 7..5 and the ID in bits 4..0, then its value. Frames end
+with 0x00 on both sides. Text the devices print between frames (boot
+messages) fails the CRC and is counted in Reader.bad, never returned as
+a record. seq is one counter per sender; gaps are counted in Reader.lost.
+A power_series record carries a TsCodec frame (Tools/tsc.py) of readings.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import argparse
+import struct
+import sys
+
+U8, U16, U32, I16, I32, F32, BYTES = range(7)
+KIND = {U8: "<B", U16: "<H", U32: "<I", I16: "<h", I32: "<i", F32: "<f"}
+HEADER = struct.Struct("<BHI")
+
+# Record types and field names, as in Telemetry.h
+RECORDS = {
+    0x01: ("power", {0: "voltage_V", 1: "current_mA", 2: "power_W", 3: "energy_Ws"}),
+    0x02: ("power_series", {0: "series"}),
+    0x10: ("rf_status", {0: "isr_avg_cycles", 1: "isr_max_cycles",
+                         2: "log_dropped", 3: "trace_dropped",
+                         4: "pool_high_water", 5: "pool_fails",
+                         6: "stack_peak", 7: "heap_used",
+                         8: "flog_blocks", 9: "flog_dropped", 10: "flog_errors",
+                         11: "flog_recover_us", 12: "wdg_resets",
+                         13: "wdg_reason", 14: "wdg_task", 15: "wdg_total"}),
+    0x11: ("rf_rx", {0: "payload"}),
+}
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(frame):
+    """One frame without its 0x00 delimiter; None if malformed."""
+    out = bytearray()
+    i = 0
+    while i < len(frame):
+        code = frame[i]
+        if code == 0 or i + code > len(frame):
+            return None
+        out += frame[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def cobs_encode(data):
+    """Reference encoder, used by the benchmark to cross-check the C one."""
+    out = bytearray([0])
+    code_pos, code = 0, 1
+    for b in data:
+        if b:
+            out.append(b)
+            code += 1
+        if not b or code == 0xFF:
+            out[code_pos] = code
+            code_pos, code = len(out), 1
+            out.append(0)
+    out[code_pos] = code
+    return bytes(out) + b"\0"
+
+
+class Record:
+    __slots__ = ("type", "name", "seq", "time_ms", "fields")
+
+    def __init__(self, rtype, seq, time_ms, fields):
+        self.type = rtype
+        self.name = RECORDS.get(rtype, ("type_0x%02x" % rtype, {}))[0]
+        self.seq = seq
+        self.time_ms = time_ms
+        self.fields = fields
+
+    def __repr__(self):
+        vals = ", ".join("%s=%s" % (k, v.hex() if isinstance(v, bytes) else
+                                    ("%.6g" % v if isinstance(v, float) else v))
+                         for k, v in self.fields.items())
+        return "%10.3f %-9s #%-5u %s" % (self.time_ms / 1000.0, self.name, self.seq, vals)
+
+
+def parse(raw):
+    """Decoded record bytes -> Record; ValueError if it does not check out."""
+    if len(raw) < HEADER.size + 2 or crc16(raw[:-2]) != struct.unpack_from("<H", raw, len(raw) - 2)[0]:
+        raise ValueError("bad crc or length")
+    rtype, seq, time_ms = HEADER.unpack_from(raw)
+    names = RECORDS.get(rtype, ("", {}))[1]
+    fields = {}
+    pos, end = HEADER.size, len(raw) - 2
+    while pos < end:
+        kind, fid = raw[pos] >> 5, raw[pos] & 0x1F
+        pos += 1
+        if kind == BYTES:
+            n = raw[pos]
+            value = bytes(raw[pos + 1:pos + 1 + n])
+            pos += 1 + n
+        elif kind in KIND:
+            value, = struct.unpack_from(KIND[kind], raw, pos)
+            pos += struct.calcsize(KIND[kind])
+        else:
+            raise ValueError("unknown field kind %u" % kind)
+        fields[names.get(fid, "f%u" % fid)] = value
+    if pos != end:
+        raise ValueError("field overruns record")
+    return Record(rtype, seq, time_ms, fields)
+
+
+class Reader:
+    """Splits a byte stream on 0x00 and returns the records that check out."""
+
+    def __init__(self):
+        self.pending = bytearray()
+        self.good = 0
+        self.bad = 0
+        self.lost = 0
+        self.last_seq = None
+
+    def feed(self, data):
+        self.pending += data
+        records = []
+        while True:
+            end = self.pending.find(0)
+            if end < 0:
+                break
+            frame = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if not frame:
+                continue
+            raw = cobs_decode(frame)
+            try:
+                if raw is None:
+                    raise ValueError("bad cobs")
+                rec = parse(raw)
+            except (ValueError, struct.error, IndexError):
+                self.bad += 1
+                continue
+            # One counter per sender, across record types
+            if self.last_seq is not None:
+                self.lost += (rec.seq - self.last_seq - 1) & 0xFFFF
+            self.last_seq = rec.seq
+            self.good += 1
+            records.append(rec)
+        return records
+
+
+def show(rec):
+    """Print a record; a power series frame prints one line per sample."""
+    if rec.type != 0x02 or "series" not in rec.fields:
+        print(rec)
+        return
+    import tsc
+
+    try:
+        samples = tsc.decode(rec.fields["series"])
+    except ValueError as e:
+        print(rec, "(%s)" % e)
+        return
+    for t, (v, ma, w, ws) in samples:
+        print("%10.3f %-9s #%-5u voltage_V=%d, current_mA=%d, power_W=%d, energy_Ws=%d"
+              % (t / 1000.0, "power", rec.seq, v, ma, w, ws))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Print telemetry records")
+    ap.add_argument("source", help="serial port or capture file")
+    ap.add_argument("--baud", type=int, default=115200)
+    opt = ap.parse_args()
+
+    reader = Reader()
+    try:
+        with open(opt.source, "rb") as f:
+            for rec in reader.feed(f.read()):
+                show(rec)
+    except FileNotFoundError:
+        import serial
+
+        ser = serial.Serial(opt.source, opt.baud, timeout=0.2)
+        try:
+            while True:
+                for rec in reader.feed(ser.read(256)):
+                    show(rec)
+                    sys.stdout.flush()
+        except KeyboardInterrupt:
+            pass
+    print("%u records, %u bad frames, %u lost by sequence" % (reader.good, reader.bad, reader.lost),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+/*
+ * telemetry_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Encodes the same HLW8012 readings as the sketch's old text line and
+ *  as telemetry records (Common/Telemetry/src/Telemetry.c), and
+ *  writes the record stream for Tools/telemetry_bench.py to decode:
+ *
+ *  gcc -O2 -Wall -I../Common/Telemetry/src telemetry_bench.c ../Common/Telemetry/src/Telemetry.c -o telemetry_bench
+ *  ./telemetry_bench out.bin [samples]
+ *
+ *  Prints: samples, text bytes, record bytes, text ns/sample, record ns/sample
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Telemetry.h"
+
+/* Define --------------------------------------------------------------------*/
+#define BENCH_SAMPLES 					100000UL
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	uint32_t 	voltage;
+	double 		current;
+	uint32_t 	power;
+	uint32_t 	energy;
+
+}Handle_Sample_S;
+
+/* Function prototypes -------------------------------------------------------*/
+
+/*
+ * @brief : Deterministic mains-like reading number i.
+ */
+static void Bench_Sample(uint32_t i, Handle_Sample_S *s)
+{
+	s->voltage = 225U + ((i * 7U) % 11U);
+	s->current = 0.2 + ((double)((i * 13U) % 1000U) / 100.0);
+	s->power   = (uint32_t)(s->voltage * s->current);
+	s->energy  = i * 5U;
+}
+
+static double Bench_Ns(struct timespec *a, struct timespec *b, unsigned long n)
+{
+	return (((double)(b->tv_sec - a->tv_sec) * 1e9) + (double)(b->tv_nsec - a->tv_nsec)) / (double)n;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long samples = (argc > 2) ? strtoul(argv[2], NULL, 0) : BENCH_SAMPLES;
+	unsigned long textBytes = 0, tlmBytes = 0, i;
+	struct timespec t0, t1, t2;
+	Handle_Sample_S s;
+	Handle_Tlm_S tlm;
+	uint8_t frame[TLM_ENCODED_MAX(32U)];
+	char line[100];
+	volatile unsigned long sink = 0;
+	FILE *out;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s out.bin [samples]\n", argv[0]);
+		return 2;
+	}
+	out = fopen(argv[1], "wb");
+	if (out == NULL) {
+		perror(argv[1]);
+		return 1;
+	}
+
+	/* The line HLW8012_esp8285.ino printed before the records */
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < samples; i++) {
+		Bench_Sample(i, &s);
+		textBytes += (unsigned long)snprintf(line, sizeof(line), "Volt : %u \t Curr : %.3lf \t Power : %u \n",
+				(unsigned)s.voltage, s.current, (unsigned)s.power);
+		sink += (unsigned char)line[7];
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	for (i = 0; i < samples; i++) {
+		uint16_t len;
+
+		Bench_Sample(i, &s);
+		Tlm_Begin(&tlm, frame, sizeof(frame), TLM_REC_POWER, (uint16_t)i, (uint32_t)(i * 200U));
+		Tlm_PutU16(&tlm, TLM_F_VOLTAGE, (uint16_t)s.voltage);
+		Tlm_PutU16(&tlm, TLM_F_CURRENT, (uint16_t)((s.current * 1000.0) + 0.5));
+		Tlm_PutU16(&tlm, TLM_F_POWER, (uint16_t)s.power);
+		Tlm_PutU32(&tlm, TLM_F_ENERGY, s.energy);
+		len = Tlm_End(&tlm);
+		if (len == 0U) {
+			fprintf(stderr, "record %lu did not fit\n", i);
+			return 1;
+		}
+		tlmBytes += len;
+		fwrite(frame, 1, len, out);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	fclose(out);
+
+	printf("%lu %lu %lu %.1f %.1f\n", samples, textBytes, tlmBytes,
+			Bench_Ns(&t0, &t1, samples), Bench_Ns(&t1, &t2, samples));
+	return (int)(sink & 0U);
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+telemetry_bench.py
+
+Throughput of the telemetry records against the text line the HLW8012
+sketch used to print. Builds Tools/telemetry_bench.c with the device
+encoder, decodes its record stream with Tools/telemetry.py, checks every
+value and sequence number, and reports samples per second on the
+115200 baud link (10 bits per byte).
+
+    python3 Tools/telemetry_bench.py [samples]
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+import telemetry
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TLM = os.path.join(os.path.dirname(HERE), "Common", "Telemetry", "src")
+LINK_BYTES_PER_S = 115200 / 10
+
+
+def sample(i):
+    """Same readings as Bench_Sample() in telemetry_bench.c."""
+    voltage = 225 + (i * 7) % 11
+    current = 0.2 + ((i * 13) % 1000) / 100.0
+    return voltage, int(current * 1000.0 + 0.5), int(voltage * current) & 0xFFFF, (i * 5) & 0xFFFFFFFF
+
+
+def main():
+    samples = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = os.path.join(tmp, "telemetry_bench")
+        subprocess.check_call(["gcc", "-O2", "-Wall", "-I", TLM,
+                               os.path.join(HERE, "telemetry_bench.c"),
+                               os.path.join(TLM, "Telemetry.c"), "-o", exe])
+        stream = os.path.join(tmp, "records.bin")
+        out = subprocess.check_output([exe, stream, str(samples)]).split()
+        n, text_bytes, tlm_bytes = int(out[0]), int(out[1]), int(out[2])
+        text_ns, tlm_ns = float(out[3]), float(out[4])
+        data = open(stream, "rb").read()
+
+    reader = telemetry.Reader()
+    start = time.perf_counter()
+    records = []
+    for at in range(0, len(data), 4096):
+        records += reader.feed(data[at:at + 4096])
+    decode_s = time.perf_counter() - start
+
+    errors = reader.bad + reader.lost + abs(len(records) - n)
+    for frame in data.split(b"\0")[:1000]:
+        if frame and telemetry.cobs_encode(telemetry.cobs_decode(frame)) != frame + b"\0":
+            errors += 1
+    for i, rec in enumerate(records):
+        f = rec.fields
+        got = (f["voltage_V"], f["current_mA"], f["power_W"], f["energy_Ws"])
+        if rec.seq != (i & 0xFFFF) or rec.time_ms != (i * 200) & 0xFFFFFFFF or got != sample(i):
+            errors += 1
+
+    text_per = text_bytes / n
+    tlm_per = tlm_bytes / n
+    print("%u samples, %u decode errors" % (n, errors))
+    print("                 bytes/sample  samples/s @115200  encode ns (host)")
+    print("text line        %12.1f  %17.0f  %16.1f" % (text_per, LINK_BYTES_PER_S / text_per, text_ns))
+    print("COBS record      %12.1f  %17.0f  %16.1f" % (tlm_per, LINK_BYTES_PER_S / tlm_per, tlm_ns))
+    print("gain             %12.2fx" % (text_per / tlm_per))
+    print("host decoder     %.0f records/s" % (len(records) / decode_s))
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
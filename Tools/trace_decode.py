@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""
+trace_decode.py
+
+Expand the RF_TRACE() records sent by RF433_Receiver
+(RF_Receiver/RF_Trace.c) back into text.
+
+    python3 Tools/trace_decode.py RF433_Receiver.elf capture.txt
+    python3 Tools/trace_decode.py RF433_Receiver.elf COM7 [--baud 115200]
+    python3 Tools/trace_decode.py RF433_Receiver.elf -        (stdin)
+
+A record line is '~' followed by hex words:
+    [id:16 | nargs:3 | ms:13] [arg0] .. [argN-1]
+id is the offset of the format string in the .trace_fmt section of the
+ELF, which the linker script keeps as a non-loaded INFO section. Other
+console lines are passed through unchanged; binary telemetry frames
+(0x00 ... 0x00, Tools/telemetry.py) are skipped. The 13-bit millisecond
+stamp is unwrapped against the previous record, so gaps of more than
+8.19 s between records lose whole wraps.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SECTION = ".trace_fmt"
+MS_WRAP = 1 << 13
+
+# Telemetry records share the UART: 0x00, COBS bytes, 0x00
+FRAME = re.compile(rb"\x00[^\x00]*\x00")
+
+# %[flags][width][.prec][length]conv -> Python has no length modifiers
+SPEC = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|z|j|t)?([diouxXcpsf%])")
+
+
+def elf_section(path, name):
+    """Raw bytes of one section, ELF32 or ELF64, either byte order."""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("%s: not an ELF file" % path)
+    is64 = elf[4] == 2
+    end = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x3A)
+        shdr = struct.Struct(end + "IIQQQQIIQQ")
+    else:
+        shoff, = struct.unpack_from(end + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x2E)
+        shdr = struct.Struct(end + "IIIIIIIIII")
+
+    sections = [shdr.unpack_from(elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    names = elf[strtab[4]:strtab[4] + strtab[5]]
+    for sec in sections:
+        sname = names[sec[0]:names.index(b"\0", sec[0])].decode()
+        if sname == name:
+            return elf[sec[4]:sec[4] + sec[5]]
+    raise ValueError("%s: no %s section (linker script, RF_TRACE_ENABLE?)" % (path, name))
+
+
+class Decoder:
+    def __init__(self, fmt_section):
+        self.fmt = fmt_section
+        self.ms = None
+
+    def string(self, fid):
+        if fid >= len(self.fmt):
+            return None
+        return self.fmt[fid:self.fmt.index(b"\0", fid)].decode("ascii", "replace")
+
+    @staticmethod
+    def expand(fmt, args):
+        args = list(args)
+
+        def conv(m):
+            flags, _, c = m.groups()
+            if c == "%":
+                return "%"
+            if not args:
+                return "<missing>"
+            v = args.pop(0)
+            if c in "di":
+                v = v - (1 << 32) if v & 0x80000000 else v
+                c = "d"
+            elif c == "p":
+                return "0x%08x" % v
+            elif c == "s":
+                return "<str@0x%08x>" % v
+            elif c == "f":
+                v = struct.unpack("<f", struct.pack("<I", v))[0]
+            elif c == "c":
+                v = chr(v & 0xFF)
+            elif c == "u":
+                c = "d"
+            return ("%" + flags + c) % v
+
+        return SPEC.sub(conv, fmt)
+
+    def record(self, words):
+        head = words[0]
+        fid, nargs, ms = head >> 16, (head >> 13) & 7, head & (MS_WRAP - 1)
+        args = words[1:]
+        if nargs != len(args):
+            return "[trace] bad record: %s" % " ".join("%08x" % w for w in words)
+
+        if self.ms is None:
+            self.ms = ms
+        else:
+            self.ms += (ms - self.ms) % MS_WRAP
+
+        fmt = self.string(fid)
+        if fmt is None:
+            return "[%9.3f] <unknown id 0x%04x> %s" % (self.ms / 1000.0, fid, args)
+        return "[%9.3f] %s" % (self.ms / 1000.0, self.expand(fmt, args).rstrip("\r\n"))
+
+    def line(self, text):
+        text = text.rstrip("\r\n")
+        if not text.startswith("~"):
+            return text
+        try:
+            words = [int(w, 16) for w in text[1:].split()]
+        except ValueError:
+            return text
+        return self.record(words) if words else text
+
+
+def text_lines(pending):
+    """Complete text lines in pending, telemetry frames removed, and the rest."""
+    pending = FRAME.sub(b"", pending)
+    frame_open = pending.find(b"\x00")
+    text, rest = (pending, b"") if frame_open < 0 else (pending[:frame_open], pending[frame_open:])
+    parts = re.split(rb"[\r\n]+", text)
+    rest = parts.pop() + rest
+    return [p.decode("ascii", "replace") for p in parts], rest
+
+
+def lines_from(source, baud):
+    if source == "-":
+        lines, rest = text_lines(sys.stdin.buffer.read() + b"\n")
+        yield from lines
+        return
+    try:
+        with open(source, "rb") as f:
+            lines, rest = text_lines(f.read() + b"\n")
+        yield from lines
+        return
+    except FileNotFoundError:
+        pass
+
+    import serial
+
+    ser = serial.Serial(source, baud, timeout=0.2)
+    pending = b""
+    while True:
+        lines, pending = text_lines(pending + ser.read(256))
+        yield from lines
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Expand RF_TRACE() records")
+    ap.add_argument("elf", help="firmware ELF with the .trace_fmt section")
+    ap.add_argument("source", help="capture file, serial port or - for stdin")
+    ap.add_argument("--baud", type=int, default=115200)
+    opt = ap.parse_args()
+
+    dec = Decoder(elf_section(opt.elf, SECTION))
+    try:
+        for line in lines_from(opt.source, opt.baud):
+            if line:
+                print(dec.line(line), flush=True)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+tsc.py
+
+Host decoder for the time-series frames of TsCodec.c (Common/Telemetry/src).
+The layout is described in TsCodec.h:
+
+    [count:8][channels:4 | dod mask:4] first sample raw, then per sample
+    the time as delta-of-delta and per channel the delta (delta-of-delta
+    for the channels in the mask), each zig-zag mapped behind a width
+    prefix: 0 | 10+4 | 110+8 | 1110+16 | 1111+32 bits, MSB first.
+
+As a library:
+
+    import tsc
+    for time, values in tsc.decode(frame):
+        ...
+
+From the command line, a frame as hex:
+
+    python3 Tools/tsc.py 3c04...
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import sys
+
+WIDTHS = (4, 8, 16, 32)
+MASK32 = 0xFFFFFFFF
+
+
+class Bits:
+    def __init__(self, data, pos):
+        self.data = data
+        self.pos = pos
+
+    def read(self, n):
+        if self.pos + n > len(self.data) * 8:
+            raise ValueError("frame ends inside a sample")
+        v = 0
+        for _ in range(n):
+            v = (v << 1) | ((self.data[self.pos >> 3] >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return v
+
+
+def _number(bits):
+    if not bits.read(1):
+        return 0
+    for width in WIDTHS[:-1]:
+        if not bits.read(1):
+            z = bits.read(width)
+            return ((z >> 1) ^ -(z & 1)) & MASK32
+    z = bits.read(32)
+    return ((z >> 1) ^ -(z & 1)) & MASK32
+
+
+def signed(v):
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def decode(frame):
+    """frame bytes -> [(time, [value per channel])]; ValueError if short."""
+    if len(frame) < 2:
+        raise ValueError("no header")
+    count, channels, dod = frame[0], frame[1] & 0x0F, frame[1] >> 4
+    if not 1 <= channels <= 4:
+        raise ValueError("bad channel count %u" % channels)
+    bits = Bits(frame, 16)
+    out = []
+    time = time_delta = 0
+    value, delta = [0] * channels, [0] * channels
+    for i in range(count):
+        if i == 0:
+            time = bits.read(32)
+            value = [bits.read(32) for _ in range(channels)]
+        else:
+            time_delta = (time_delta + _number(bits)) & MASK32
+            time = (time + time_delta) & MASK32
+            for c in range(channels):
+                x = _number(bits)
+                delta[c] = ((delta[c] + x) if dod & (1 << c) else x) & MASK32
+                value[c] = (value[c] + delta[c]) & MASK32
+        out.append((time, [signed(v) for v in value]))
+    return out
+
+
+def main():
+    frame = bytes.fromhex("".join(sys.argv[1:]))
+    for time, values in decode(frame):
+        print(time, " ".join(str(v) for v in values))
+
+
+if __name__ == "__main__":
+    main()
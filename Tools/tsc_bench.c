@@ -0,0 +1,209 @@
+/*
+ * tsc_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Yoganathan.V
+ *
+ *  Runs the time-series codec (Common/Telemetry/src/TsCodec.c) on
+ *  synthetic metering traces, checks that every frame decodes back to
+ *  the samples put in, and reports the size against raw records and
+ *  the encode time per sample:
+ *
+ *  gcc -O2 -Wall -I../Common/Telemetry/src tsc_bench.c \
+ *      ../Common/Telemetry/src/TsCodec.c -o tsc_bench
+ *  ./tsc_bench [samples] [seed]
+ *
+ *  A trace is V, I (mA), P (W) and energy (Ws) sampled every second
+ *  with some jitter, as the HLW8012 sketch reads them; V is in mV here,
+ *  finer than the sketch's whole volts, which makes it harder. Frames
+ *  are TSC_BENCH_FRAME bytes, the payload of one telemetry record.
+ *  Encode cycles on the targets come from the TSC_BENCH build of the
+ *  RF433 receiver (main.c); the host figure is only for comparison.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TsCodec.h"
+
+/* Define --------------------------------------------------------------------*/
+#define TSC_BENCH_FRAME 				200U
+#define TSC_BENCH_CHANNELS 				4U
+#define TSC_BENCH_DOD 					0x08U		/* energy is a counter			*/
+#define TSC_BENCH_FRAMES_MAX 			200000U
+
+/* Typedef -------------------------------------------------------------------*/
+typedef struct {
+	const char 	*name;
+	void 		(*next)(uint32_t *time, int32_t *v);
+
+}Bench_Trace_S;
+
+/* Variables -----------------------------------------------------------------*/
+static uint32_t rng = 1;
+static double energyWs;
+static int32_t loadW;
+
+static uint8_t frames[TSC_BENCH_FRAMES_MAX][TSC_BENCH_FRAME];
+static uint16_t frameLen[TSC_BENCH_FRAMES_MAX];
+static uint8_t frameCount[TSC_BENCH_FRAMES_MAX];
+
+/* Function prototypes -------------------------------------------------------*/
+
+static uint32_t Bench_Rand(void)
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static int32_t Bench_Noise(int32_t span)
+{
+	return (int32_t)(Bench_Rand() % (uint32_t)(2 * span + 1)) - span;
+}
+
+/*
+ * @brief : Readings for a load of loadW watts on 230 V mains
+ */
+static void Bench_Reading(uint32_t *time, int32_t *v, int32_t vNoise, int32_t iNoise, int32_t jitterMs)
+{
+	int32_t mv = 230000 + Bench_Noise(vNoise);
+	int32_t ma = (int32_t)(((int64_t)loadW * 1000000) / mv) + Bench_Noise(iNoise);
+	uint32_t dt = 1000U + (uint32_t)Bench_Noise(jitterMs);
+
+	*time    += dt;
+	v[0]      = mv;
+	v[1]      = ma;
+	v[2]      = (int32_t)(((int64_t)mv * ma) / 1000000);
+	energyWs += v[2] * (dt / 1000.0);
+	v[3]      = (int32_t)energyWs;
+}
+
+/* A fridge-like steady load, quiet meter, tight sampling */
+static void Bench_Steady(uint32_t *time, int32_t *v)
+{
+	loadW = 120;
+	Bench_Reading(time, v, 40, 2, 0);
+}
+
+/* Kettle, heater and lights switching on and off every few minutes */
+static void Bench_Steps(uint32_t *time, int32_t *v)
+{
+	static const int32_t loads[] = { 60, 60, 2000, 60, 800, 1460, 60, 5 };
+
+	if ((Bench_Rand() % 180U) == 0U) {
+		loadW = loads[Bench_Rand() % (sizeof(loads) / sizeof(loads[0]))];
+	}
+	Bench_Reading(time, v, 300, 8, 3);
+}
+
+/* A noisy line and a wandering load, sampling jitter of +-20 ms */
+static void Bench_Noisy(uint32_t *time, int32_t *v)
+{
+	loadW += Bench_Noise(15);
+	loadW = (loadW < 10) ? 10 : (loadW > 3000) ? 3000 : loadW;
+	Bench_Reading(time, v, 2500, 40, 20);
+}
+
+static const Bench_Trace_S traces[] = {
+	{ "steady", Bench_Steady },
+	{ "steps",  Bench_Steps  },
+	{ "noisy",  Bench_Noisy  },
+};
+
+/*
+ * @brief : Encode a trace, decode it back and compare
+ * @retval : 0 when every sample came back
+ */
+static int Bench_Run(const Bench_Trace_S *trace, uint32_t samples)
+{
+	static uint32_t times[TSC_BENCH_FRAMES_MAX];
+	static int32_t values[TSC_BENCH_FRAMES_MAX][TSC_BENCH_CHANNELS];
+	Handle_Tsc_S tsc;
+	Handle_TscDec_S dec;
+	uint32_t i, f = 0, t, bytes = 0, raw;
+	int32_t v[TSC_BENCH_CHANNELS];
+	clock_t t0;
+	double ns;
+
+	if (samples > TSC_BENCH_FRAMES_MAX) {
+		samples = TSC_BENCH_FRAMES_MAX;
+	}
+
+	rng = rng ? rng : 1U;
+	energyWs = 0;
+	loadW = 60;
+	t = 1000000U;
+	for (i = 0; i < samples; i++) {
+		trace->next(&t, values[i]);
+		times[i] = t;
+	}
+
+	t0 = clock();
+	Tsc_Begin(&tsc, frames[0], TSC_BENCH_FRAME, TSC_BENCH_CHANNELS, TSC_BENCH_DOD);
+	for (i = 0; i < samples; i++) {
+		if (!Tsc_Put(&tsc, times[i], values[i])) {
+			frameCount[f] = tsc.count;
+			frameLen[f]   = Tsc_End(&tsc);
+			f++;
+			Tsc_Begin(&tsc, frames[f], TSC_BENCH_FRAME, TSC_BENCH_CHANNELS, TSC_BENCH_DOD);
+			Tsc_Put(&tsc, times[i], values[i]);
+		}
+	}
+	frameCount[f] = tsc.count;
+	frameLen[f]   = Tsc_End(&tsc);
+	f++;
+	ns = (double)(clock() - t0) * 1e9 / CLOCKS_PER_SEC / samples;
+
+	/* Every frame on its own, as the host gets them */
+	i = 0;
+	for (uint32_t k = 0; k < f; k++) {
+		bytes += frameLen[k];
+		if (Tsc_DecodeBegin(&dec, frames[k], frameLen[k]) != frameCount[k]) {
+			printf("%s: frame %u header does not match\n", trace->name, k);
+			return -1;
+		}
+		while (Tsc_DecodeNext(&dec, &t, v)) {
+			if ((i >= samples) || (t != times[i]) || memcmp(v, values[i], sizeof(v))) {
+				printf("%s: sample %u differs after decoding\n", trace->name, i);
+				return -1;
+			}
+			i++;
+		}
+		if (dec.overrun || (dec.left != 0U)) {
+			printf("%s: frame %u is short\n", trace->name, k);
+			return -1;
+		}
+	}
+	if (i != samples) {
+		printf("%s: %u of %u samples decoded\n", trace->name, i, samples);
+		return -1;
+	}
+
+	raw = samples * TSC_RAW_LEN(TSC_BENCH_CHANNELS);
+	printf("%-7s %8u %7u %9u %9u %6.1fx %8.1f %7.1f %8.1f\n",
+			trace->name, samples, f, raw, bytes, (double)raw / bytes,
+			bytes * 8.0 / samples, (double)samples / f, ns);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t samples = (argc > 1) ? (uint32_t)atoi(argv[1]) : 86400U;
+	uint32_t k;
+
+	rng = (argc > 2) ? (uint32_t)atoi(argv[2]) : 1U;
+
+	printf("%u channels (mV, mA, W, Ws), %u byte frames, raw sample %u bytes\n",
+			TSC_BENCH_CHANNELS, TSC_BENCH_FRAME, TSC_RAW_LEN(TSC_BENCH_CHANNELS));
+	printf("trace    samples  frames  raw bytes   encoded  ratio bits/smp smp/frm  host ns\n");
+	for (k = 0; k < sizeof(traces) / sizeof(traces[0]); k++) {
+		if (Bench_Run(&traces[k], samples) != 0) {
+			return 1;
+		}
+	}
+	return 0;
+}
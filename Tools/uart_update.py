@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+uart_update.py
+
+Send a signed image to the inactive flash bank over USART2
+(Boot/Boot_Update.c in L0_APP1 / L0_APP2).
+
+    python3 Tools/uart_update.py COM5 L0_APP2_signed.bin [--switch]
+    python3 Tools/uart_update.py COM5 app.dlt --delta      (Tools/delta_diff.py)
+
+Every frame is 264 bytes: [0xA5][type][seq:16][len:16][crc16:16][256 payload]
+Two frames are kept in flight, so the device programs one chunk while
+the next is received. A NAK rewinds to the chunk the device expects.
+A delta chunk can take seconds to apply; the device holds the frame
+behind it and sends a "busy" ACK every second until the chunk is done.
+Re-running the command after an interruption resumes where the
+device's saved resume point says it stopped.
+
+Created on: Oct 19, 2026
+    Author: Yoganathan.V
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+import serial
+
+SOF = 0xA5
+CHUNK = 256
+HEADER = struct.Struct("<BBHHH")
+BEGIN, DATA, END, SWITCH, ACK, NAK = 0x01, 0x02, 0x03, 0x04, 0x81, 0x82
+WINDOW = 2
+SLOT_HEADER_OFFSET = 0xC0
+FLAG_DELTA = 0x01
+
+STATUS = ["ok", "bad frame", "bad state", "bad length", "gap", "overrun",
+          "flash error", "bad image", "busy"]
+BUSY = 8
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def frame(ftype, seq=0, payload=b""):
+    payload = payload.ljust(CHUNK, b"\0")
+    head = HEADER.pack(SOF, ftype, seq, len(payload), 0)[:6]
+    return head + struct.pack("<H", crc16(payload, crc16(head))) + payload
+
+
+class Link:
+    def __init__(self, port, baud):
+        self.ser = serial.Serial(port, baud, timeout=0.05)
+        self.rx = bytearray()
+
+    def send(self, data):
+        self.ser.write(data)
+
+    def reply(self, timeout):
+        """Next valid reply header as (type, seq, status), or None."""
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            self.rx += self.ser.read(64)
+            while len(self.rx) >= HEADER.size:
+                if self.rx[0] != SOF:
+                    del self.rx[0]          # log text shares the UART
+                    continue
+                sof, ftype, seq, status, crc = HEADER.unpack_from(self.rx)
+                if crc16(self.rx[:6]) == crc and ftype in (ACK, NAK):
+                    del self.rx[:HEADER.size]
+                    return ftype, seq, status
+                del self.rx[0]
+        return None
+
+
+def command(link, ftype, seq, payload, timeout, retries=5):
+    for _ in range(retries):
+        link.send(frame(ftype, seq, payload))
+        r = link.reply(timeout)
+        if r is not None:
+            return r
+        time.sleep(0.01)
+    sys.exit("no reply to frame type 0x%02X" % ftype)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="UART firmware update for STM32L0 A/B banks")
+    parser.add_argument("port")
+    parser.add_argument("image", help="binary signed with Tools/slot_sign.py")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--switch", action="store_true", help="boot the new bank when done")
+    parser.add_argument("--delta", action="store_true",
+                        help="image is a patch against the running image")
+    args = parser.parse_args()
+
+    image = open(args.image, "rb").read()
+    if args.delta:
+        # new image CRC from the patch header; long COPY ops send "busy" keep-alives
+        image_crc = struct.unpack_from("<I", image, 12)[0]
+        flags, ack_timeout = FLAG_DELTA, 3.0
+    else:
+        image_crc = struct.unpack_from("<I", image, SLOT_HEADER_OFFSET + 12)[0]
+        flags, ack_timeout = 0, 0.5
+    chunks = (len(image) + CHUNK - 1) // CHUNK
+    link = Link(args.port, args.baud)
+
+    # BEGIN is answered once the bank is erased (~3 ms per 128 byte page)
+    ftype, start, status = command(link, BEGIN, 0, struct.pack("<III", len(image), image_crc, flags), 5.0)
+    if ftype != ACK:
+        sys.exit("BEGIN refused: %s" % STATUS[status])
+    if start:
+        print("resuming at chunk %u of %u" % (start, chunks))
+
+    t0 = time.monotonic()
+    base = start            # oldest unacknowledged chunk
+    sent = start            # next chunk to send
+    naks = 0
+    while base < chunks:
+        while sent < chunks and sent - base < WINDOW:
+            link.send(frame(DATA, sent, image[sent * CHUNK:(sent + 1) * CHUNK]))
+            sent += 1
+        r = link.reply(ack_timeout)
+        if r is None:
+            sent = base     # lost frame or reply: go back
+            continue
+        ftype, seq, status = r
+        if ftype == NAK:
+            naks += 1
+            if status in (6, 7, 2):
+                sys.exit("update failed: %s" % STATUS[status])
+            # frame in flight finishes, then the device needs a quiet line to re-arm
+            time.sleep((CHUNK + HEADER.size) * 10.0 / args.baud + 0.01)
+            link.ser.reset_input_buffer()
+            base = sent = seq
+        elif status == BUSY:
+            continue        # chunk still being applied, the window is held
+        else:
+            base = max(base, seq)
+        sys.stdout.write("\r%3u%%" % (100 * base // chunks))
+        sys.stdout.flush()
+
+    elapsed = time.monotonic() - t0
+    done = (chunks - start) * CHUNK
+    line = args.baud / 10.0 * CHUNK / (CHUNK + HEADER.size)
+    print("\r%u bytes in %.2f s: %.0f B/s (%.0f%% of line rate), %u NAKs"
+          % (done, elapsed, done / elapsed, 100 * done / elapsed / line, naks))
+
+    ftype, _, status = command(link, END, 0, b"", 2.0)
+    if ftype != ACK:
+        sys.exit("image check failed: %s" % STATUS[status])
+    print("image verified")
+
+    if args.switch:
+        link.send(frame(SWITCH))
+        print("switching bank")
+
+
+if __name__ == "__main__":
+    main()